@@ -208,6 +208,19 @@ function obe.collision._CollisionSpace:get_all_colliders() end
 ---@param collider obe.collision.Collider #Pointer to the collider to remove from the CollisionSpace
 function obe.collision._CollisionSpace:remove_collider(collider) end
 
+--- Reinserts a Collider in the Quadtree right away.
+---
+---@param collider obe.collision.Collider #Pointer to the collider to reinsert
+function obe.collision._CollisionSpace:refresh_collider(collider) end
+
+--- Rebuilds the Quadtree from all the Colliders of the CollisionSpace.
+---
+function obe.collision._CollisionSpace:refresh_quadtree() end
+
+--- Reinserts all the Colliders that moved since the last update in the Quadtree.
+---
+function obe.collision._CollisionSpace:update() end
+
 ---@param collider obe.collision.Collider #
 ---@return boolean
 function obe.collision._CollisionSpace:collides(collider) end
@@ -232,6 +245,52 @@ function obe.collision._CollisionSpace:clear_blacklist(source_tag) end
 ---@return std.unordered_set[string]
 function obe.collision._CollisionSpace:get_blacklist(source_tag) end
 
+--- Sets how many worker threads share the narrowphase of batched queries (get_all_collisions and batched get_reachable_colliders).
+---
+---@param workers number #Amount of worker threads, 0 runs the narrowphase on the calling thread only
+function obe.collision._CollisionSpace:set_narrowphase_workers(workers) end
+
+---@return number
+function obe.collision._CollisionSpace:get_narrowphase_workers() end
+
+--- Switches to another broadphase, the Colliders are inserted in the new one right away.
+---
+---@param type obe.collision.BroadphaseType #Broadphase to use from now on
+function obe.collision._CollisionSpace:set_broadphase(type) end
+
+---@return obe.collision.BroadphaseType
+function obe.collision._CollisionSpace:get_broadphase() end
+
+--- Sets the side of the cells of the SpatialHashGrid broadphase, it is rebuilt if it is in use.
+---
+---@param cell_size number #Side of the cells, ideally close to the size of the Colliders
+function obe.collision._CollisionSpace:set_grid_cell_size(cell_size) end
+
+---@return number
+function obe.collision._CollisionSpace:get_grid_cell_size() end
+
+--- Gets the area covered by the Quadtree broadphase, the SpatialHashGrid is unbounded and gives an empty AABB.
+---
+---@return obe.transform.AABB
+function obe.collision._CollisionSpace:get_bounds() end
+
+--- Gets the depth and leaf occupancy of the Quadtree broadphase, empty stats are given when the SpatialHashGrid is in use.
+---
+---@return obe.collision.QuadtreeStats
+function obe.collision._CollisionSpace:get_quadtree_stats() end
+
+--- Sets when the nodes of the Quadtree broadphase are split, the Quadtree is rebuilt with the new limits if it is in use.
+---
+---@param threshold number #Amount of Colliders a leaf holds before being split
+---@param max_depth number #Depth past which leaves are never split
+function obe.collision._CollisionSpace:set_quadtree_limits(threshold, max_depth) end
+
+---@return number
+function obe.collision._CollisionSpace:get_quadtree_threshold() end
+
+---@return number
+function obe.collision._CollisionSpace:get_quadtree_max_depth() end
+
 
 ---@class obe.collision.PolygonCollider : obe.collision.Collider
 ---@field Type obe.collision.ColliderType #
@@ -310,11 +369,31 @@ obe.collision._Quadtree = {};
 function obe.collision.Quadtree(box) end
 
 
----@param value obe.collision.Collider #
-function obe.collision._Quadtree:add(value) end
+--- Removes all the values and makes the Quadtree cover a new area.
+---
+---@param box obe.transform.AABB #New area covered by the Quadtree
+function obe.collision._Quadtree:reset(box) end
 
----@param value obe.collision.Collider #
-function obe.collision._Quadtree:remove(value) end
+---@return obe.transform.AABB
+function obe.collision._Quadtree:get_box() end
+
+---@return number
+function obe.collision._Quadtree:get_threshold() end
+
+---@return number
+function obe.collision._Quadtree:get_max_depth() end
+
+--- Inserts a Collider in the Quadtree.
+---
+---@param value obe.collision.Collider #Collider to insert
+---@param box obe.transform.AABB #Bounding box of the Collider, the Quadtree keeps it until the Collider is removed
+function obe.collision._Quadtree:add(value, box) end
+
+--- Removes a Collider from the Quadtree.
+---
+---@param value obe.collision.Collider #Collider to remove
+---@param box obe.transform.AABB #Bounding box the Collider was inserted with, which may differ from its current one if it moved since
+function obe.collision._Quadtree:remove(value, box) end
 
 ---@param box obe.transform.AABB #
 ---@return obe.collision.Collider[]
@@ -323,6 +402,57 @@ function obe.collision._Quadtree:query(box) end
 ---@return Tuple_ObeCollisionCollider_ConstobeCollisionCollider[]
 function obe.collision._Quadtree:find_all_intersections() end
 
+--- Walks the Quadtree to measure its depth and the occupancy of its leaves.
+---
+---@return obe.collision.QuadtreeStats
+function obe.collision._Quadtree:get_stats() end
+
+
+---@class obe.collision.QuadtreeStats
+---@field nodes number #Amount of nodes in use, interior nodes and leaves
+---@field leaves number #
+---@field depth number #Depth of the deepest leaf, 0 when the root was never split
+---@field values number #
+---@field interior_values number #Amount of values held by interior nodes because they straddle the boundaries of their children
+---@field max_leaf_values number #
+---@field average_leaf_values number #
+obe.collision._QuadtreeStats = {};
+
+
+---@class obe.collision.SpatialHashGrid
+obe.collision._SpatialHashGrid = {};
+
+--- obe.collision.SpatialHashGrid constructor
+---
+---@param cell_size? number #Side of the cells, ideally close to the size of the Colliders it holds
+---@return obe.collision.SpatialHashGrid
+function obe.collision.SpatialHashGrid(cell_size) end
+
+
+function obe.collision._SpatialHashGrid:clear() end
+
+---@return number
+function obe.collision._SpatialHashGrid:get_cell_size() end
+
+--- Inserts a Collider in the SpatialHashGrid.
+---
+---@param value obe.collision.Collider #Collider to insert
+---@param box obe.transform.AABB #Bounding box of the Collider, the SpatialHashGrid keeps it until the Collider is removed
+function obe.collision._SpatialHashGrid:add(value, box) end
+
+--- Removes a Collider from the SpatialHashGrid.
+---
+---@param value obe.collision.Collider #Collider to remove
+---@param box obe.transform.AABB #Bounding box the Collider was inserted with
+function obe.collision._SpatialHashGrid:remove(value, box) end
+
+---@param box obe.transform.AABB #
+---@return obe.collision.Collider[]
+function obe.collision._SpatialHashGrid:query(box) end
+
+---@return Tuple_ObeCollisionCollider_ConstobeCollisionCollider[]
+function obe.collision._SpatialHashGrid:find_all_intersections() end
+
 
 ---@class obe.collision.RectangleCollider : obe.collision.Collider
 ---@field Type obe.collision.ColliderType #
@@ -415,6 +545,9 @@ function obe.collision._Trajectory:get_on_collide_callback() end
 ---@return number
 function obe.collision._Trajectory:get_speed() end
 
+---@return number
+function obe.collision._Trajectory:get_substep_length() end
+
 ---@return boolean
 function obe.collision._Trajectory:is_static() end
 
@@ -443,6 +576,12 @@ function obe.collision._Trajectory:set_speed(speed) end
 ---@return obe.collision.Trajectory
 function obe.collision._Trajectory:set_static(static_) end
 
+--- Splits the movement of each update in substeps no longer than a given length, each one checked for collisions on its own.
+---
+---@param length number #Maximum length of a substep in the unit of the Trajectory, 0 moves by the whole offset at once
+---@return obe.collision.Trajectory
+function obe.collision._Trajectory:set_substep_length(length) end
+
 
 ---@class obe.collision.TrajectoryNode
 obe.collision._TrajectoryNode = {};
@@ -450,8 +589,9 @@ obe.collision._TrajectoryNode = {};
 --- obe.collision.TrajectoryNode constructor
 ---
 ---@param scene_node obe.scene.SceneNode #
+---@param system? obe.collision.TrajectorySystem #TrajectorySystem updating the TrajectoryNode every frame
 ---@return obe.collision.TrajectoryNode
-function obe.collision.TrajectoryNode(scene_node) end
+function obe.collision.TrajectoryNode(scene_node, system) end
 
 
 ---@param id string #
@@ -473,10 +613,52 @@ function obe.collision._TrajectoryNode:remove_trajectory(id) end
 ---@param probe obe.collision.Collider #
 function obe.collision._TrajectoryNode:set_probe(collision_space, probe) end
 
+--- Gets the TrajectorySystem updating the TrajectoryNode.
+---
+---@return obe.collision.TrajectorySystem
+function obe.collision._TrajectoryNode:get_system() end
+
 ---@param dt number #
 function obe.collision._TrajectoryNode:update(dt) end
 
 
+---@class obe.collision.TrajectorySystem : obe.types.Togglable
+obe.collision._TrajectorySystem = {};
+
+--- obe.collision.TrajectorySystem constructor
+---
+---@return obe.collision.TrajectorySystem
+function obe.collision.TrajectorySystem() end
+
+
+--- Adds a TrajectoryNode to the TrajectorySystem, it is removed from its previous TrajectorySystem if it had one.
+---
+---@param node obe.collision.TrajectoryNode #TrajectoryNode to update every frame
+function obe.collision._TrajectorySystem:add(node) end
+
+---@param node obe.collision.TrajectoryNode #
+function obe.collision._TrajectorySystem:remove(node) end
+
+--- Removes all TrajectoryNodes driving a SceneNode, must be called before the SceneNode is destroyed.
+---
+---@param scene_node obe.scene.SceneNode #SceneNode being destroyed
+function obe.collision._TrajectorySystem:remove_nodes(scene_node) end
+
+function obe.collision._TrajectorySystem:clear() end
+
+---@param node obe.collision.TrajectoryNode #
+---@return boolean
+function obe.collision._TrajectorySystem:contains(node) end
+
+---@return number
+function obe.collision._TrajectorySystem:get_nodes_amount() end
+
+--- Updates every TrajectoryNode of the TrajectorySystem, does nothing while the TrajectorySystem is disabled.
+---
+---@param dt number #Delta time of the frame
+function obe.collision._TrajectorySystem:update(dt) end
+
+
 ---@class obe.collision.CollisionRejectionPair
 ---@field collider1 obe.collision.Collider #
 ---@field collider2 obe.collision.Collider #
@@ -514,4 +696,14 @@ obe.collision.ColliderType = {
     ---@type obe.collision.ColliderType
     Polygon = 4,
 };
+
+--- Structure used by a CollisionSpace to find the Colliders close to each other.
+---
+---@class obe.collision.BroadphaseType
+obe.collision.BroadphaseType = {
+    ---@type obe.collision.BroadphaseType
+    Quadtree = 0,
+    ---@type obe.collision.BroadphaseType
+    SpatialHashGrid = 1,
+};
 return obe.collision;
\ No newline at end of file
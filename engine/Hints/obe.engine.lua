@@ -40,6 +40,11 @@ function obe.engine._ResourceManagedObject:attach_resource_manager(resources) en
 
 ---@class obe.engine.ResourceManager
 ---@field default_anti_aliasing boolean #
+---@field use_texture_atlas boolean #Packs small textures requested through get_texture_part into shared atlas pages so Sprites using them can be batched together
+---@field atlas_page_size number #Width and height of the atlas pages (clamped to the maximum texture size)
+---@field atlas_max_image_size number #Textures wider or taller than this are never packed in the atlas
+---@field async_uploads_per_update number #Maximum amount of asynchronously decoded textures uploaded to the GPU per call to update (0 means no limit)
+---@field placeholder_color obe.graphics.Color #Color of the placeholder used by textures that are still loading
 obe.engine._ResourceManager = {};
 
 --- obe.engine.ResourceManager constructor
@@ -63,6 +68,50 @@ function obe.engine._ResourceManager:get_texture(path, anti_aliasing) end
 ---@return obe.graphics.Texture
 function obe.engine._ResourceManager:get_texture(path) end
 
+--- Get the texture at the given path as a TexturePart. When use_texture_atlas is enabled, small textures are packed in a shared atlas page and the TexturePart only covers their region. Otherwise the TexturePart covers the whole cached texture.
+---
+---@param path obe.system.Path #Relative of absolute path to the texture, it uses the obe::System::Path loading system
+---@param anti_aliasing boolean #Uses Anti-Aliasing for the texture when first loading it
+---@return obe.graphics.TexturePart
+function obe.engine._ResourceManager:get_texture_part(path, anti_aliasing) end
+
+---@param path obe.system.Path #
+---@return obe.graphics.TexturePart
+function obe.engine._ResourceManager:get_texture_part(path) end
+
+--- Get the occupancy report of the texture atlas pages (both anti-aliased and aliased pages are accounted)
+---
+---@return obe.graphics.TextureAtlasStats
+function obe.engine._ResourceManager:get_atlas_stats() end
+
+--- Starts loading the texture at the given path in the background. The image is decoded by a worker thread and uploaded to the GPU by update() on the main thread.
+---
+---@param path obe.system.Path #Relative of absolute path to the texture, it uses the obe::System::Path loading system
+---@param anti_aliasing boolean #Uses Anti-Aliasing for the texture when first loading it
+---@param callback? fun(texture:obe.graphics.Texture) #Function called on the main thread once the texture is ready (immediately if the texture is already in cache)
+---@return obe.graphics.Texture
+function obe.engine._ResourceManager:load_texture_async(path, anti_aliasing, callback) end
+
+---@param path obe.system.Path #
+---@param callback? fun(texture:obe.graphics.Texture) #
+---@return obe.graphics.Texture
+function obe.engine._ResourceManager:load_texture_async(path, callback) end
+
+--- Starts loading the font at the given path in the background
+---
+---@param path string #Path to the font, it uses the obe::System::Path loading system
+---@param callback? fun(font:obe.graphics.Font) #Function called on the main thread once the font is ready (immediately if the font is already in cache)
+---@return obe.graphics.Font
+function obe.engine._ResourceManager:load_font_async(path, callback) end
+
+--- Uploads the textures and fonts decoded in the background and calls their callbacks, the Engine calls it once per update
+function obe.engine._ResourceManager:update() end
+
+--- Amount of textures and fonts still being loaded in the background
+---
+---@return number
+function obe.engine._ResourceManager:get_pending_loads() end
+
 function obe.engine._ResourceManager:clean() end
 
 
@@ -57,15 +57,42 @@ function obe.event._EventBase:get_name() end
 ---@return string
 function obe.event._EventBase:get_identifier() end
 
+--- Sets if queuing the Event replaces the event already queued since the last flush instead of adding a new one (only used in queued EventGroups)
+---
+---@param coalescing boolean #true if only the last queued event should be delivered
+function obe.event._EventBase:set_coalescing(coalescing) end
+
+---@return boolean
+function obe.event._EventBase:is_coalescing() end
+
+--- Sets if external listeners receive all queued events at once in an array instead of one call per event (only used in queued EventGroups)
+---
+---@param batched boolean #true if external listeners should receive arrays of events
+function obe.event._EventBase:set_batched(batched) end
+
+---@return boolean
+function obe.event._EventBase:is_batched() end
+
+--- Get the amount of events waiting for the next flush.
+---
+---@return number
+function obe.event._EventBase:get_queued_amount() end
+
+--- Get the amount of listeners (C++ and external) registered to the Event.
+---
+---@return number
+function obe.event._EventBase:get_listeners_amount() end
+
 --- Registers a listener that will be called when the Event is triggered.
 ---
 ---@param id string #of the listener being added
 ---@param listener obe.event.ExternalEventListener #Listener to register
+---@return obe.event.ListenerHandle
 function obe.event._EventBase:add_external_listener(id, listener) end
 
 --- Removes a Listener from the Event.
 ---
----@param id string #id of the Listener to unregister
+---@param id string|obe.event.ListenerHandle #id of the Listener to unregister or the handle returned when it was registered
 function obe.event._EventBase:remove_external_listener(id) end
 
 
@@ -93,6 +120,20 @@ function obe.event._EventGroup:set_joinable(joinable) end
 ---@return boolean
 function obe.event._EventGroup:is_joinable() end
 
+--- Sets if the Events triggered from the EventGroup are queued and only delivered on the next flush, pending events are flushed when disabling the queued mode.
+---
+---@param queued boolean #true if the EventGroup should queue its Events, false otherwise
+function obe.event._EventGroup:set_queued(queued) end
+
+--- Get if the EventGroup queues its Events or not.
+---
+---@return boolean
+function obe.event._EventGroup:is_queued() end
+
+--- Delivers the events queued since the last flush, Event by Event in the order they were triggered.
+---
+function obe.event._EventGroup:flush() end
+
 ---@param event_name string #
 ---@return obe.event.EventBase
 function obe.event._EventGroup:get(event_name) end
@@ -231,6 +272,10 @@ function obe.event.EventManager() end
 ---
 function obe.event._EventManager:update() end
 
+--- Delivers the events queued by every queued EventGroup.
+---
+function obe.event._EventManager:flush() end
+
 --- Clears the EventManager.
 ---
 function obe.event._EventManager:clear() end
@@ -312,6 +357,10 @@ function obe.event._EventNamespace:is_joinable() end
 ---@return string
 function obe.event._EventNamespace:get_name() end
 
+--- Flushes every queued EventGroup of the EventNamespace.
+---
+function obe.event._EventNamespace:flush() end
+
 
 ---@class obe.event.EventNamespaceView
 obe.event._EventNamespaceView = {};
@@ -346,6 +395,17 @@ function obe.event._EventNamespaceView:does_group_exists(group) end
 function obe.event._EventNamespaceView:get_name() end
 
 
+---@class obe.event.ListenerHandle
+---@field index number #Index of the slot of the listener
+---@field generation number #Generation of the slot when the listener was registered
+obe.event._ListenerHandle = {};
+
+--- obe.event.ListenerHandle constructor
+---
+---@return obe.event.ListenerHandle
+function obe.event.ListenerHandle() end
+
+
 ---@class obe.event.LuaEventListener
 obe.event._LuaEventListener = {};
 
@@ -1,6 +1,24 @@
 ---@meta
 
 obe.events.Scene = {};
+---@class obe.events.Scene.CollisionBegin
+---@field collider1 obe.collision.Collider #
+---@field collider2 obe.collision.Collider #
+---@field id string #
+obe.events.Scene._CollisionBegin = {};
+
+---@class obe.events.Scene.CollisionEnd
+---@field collider1 obe.collision.Collider #
+---@field collider2 obe.collision.Collider #
+---@field id string #
+obe.events.Scene._CollisionEnd = {};
+
+---@class obe.events.Scene.CollisionStay
+---@field collider1 obe.collision.Collider #
+---@field collider2 obe.collision.Collider #
+---@field id string #
+obe.events.Scene._CollisionStay = {};
+
 ---@class obe.events.Scene.Loaded
 ---@field filename string #
 ---@field id string #
@@ -35,6 +35,9 @@ obe.events._EventTableGroups._Network = {};
 
 
 ---@class obe.events._EventTableGroups.Scene
+---@field CollisionBegin fun(evt:obe.events.Scene.CollisionBegin) #
+---@field CollisionEnd fun(evt:obe.events.Scene.CollisionEnd) #
+---@field CollisionStay fun(evt:obe.events.Scene.CollisionStay) #
 ---@field Loaded fun(evt:obe.events.Scene.Loaded) #
 obe.events._EventTableGroups._Scene = {};
 
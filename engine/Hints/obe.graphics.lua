@@ -237,6 +237,14 @@ function obe.graphics._Color:to_string() end
 function obe.graphics._Color:Random(random_alpha) end
 
 
+---@class obe.graphics.CullingStats
+---@field sprites number #Amount of Sprites handled by the SpriteCuller
+---@field tested number #Amount of Sprites returned by the spatial index and tested against the Camera
+---@field culled number #Amount of Sprites that were skipped because they are outside of the Camera
+---@field reindexed number #Amount of Sprites that moved and had to be reinserted in the spatial index
+obe.graphics._CullingStats = {};
+
+
 ---@class obe.graphics.EditorSprite : obe.graphics.Sprite
 obe.graphics._EditorSprite = {};
 
@@ -383,6 +391,11 @@ function obe.graphics._Renderable:get_sublayer() end
 ---@return boolean
 function obe.graphics._Renderable:is_visible() end
 
+--- Get whether the Renderable was found outside of the Camera during the last culling pass.
+---
+---@return boolean
+function obe.graphics._Renderable:is_culled() end
+
 --- Set the layer of the Renderable.
 ---
 ---@param layer number #Layer where to put the Renderable (Higher layer is behind lower ones)
@@ -665,6 +678,13 @@ function obe.graphics._Sprite:attach_resource_manager(resources) end
 function obe.graphics._Sprite:type() end
 
 
+---@class obe.graphics.SpriteBatchStats
+---@field sprites number #Amount of quads submitted to the SpriteBatch
+---@field draw_calls number #Amount of draw calls issued by the SpriteBatch
+---@field texture_switches number #Amount of times a quad used a different texture than the previous one
+obe.graphics._SpriteBatchStats = {};
+
+
 ---@class obe.graphics.SpriteHandlePoint
 ---@field m_dp obe.transform.UnitVector #
 ---@field radius number #The radius of a HandlePoint.
@@ -848,6 +868,15 @@ function obe.graphics._Texture:is_bitmap() end
 function obe.graphics._Texture:make_shared_texture() end
 
 
+---@class obe.graphics.TextureAtlasStats
+---@field pages number #
+---@field images number #
+---@field used_pixels number #Amount of pixels used by the packed images (padding included)
+---@field total_pixels number #
+---@field occupancy number #Ratio between used_pixels and total_pixels (0 when there is no page)
+obe.graphics._TextureAtlasStats = {};
+
+
 ---@class obe.graphics.Hsv
 ---@field H number #
 ---@field S number #
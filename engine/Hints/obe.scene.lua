@@ -230,6 +230,11 @@ function obe.scene._Scene:remove_collider(id) end
 ---@return obe.collision.CollisionSpace
 function obe.scene._Scene:get_collision_space() end
 
+--- Gets the TrajectorySystem updating the TrajectoryNodes of the Scene, the TrajectoryNodes driving the SceneNode of a GameObject are removed along with it.
+---
+---@return obe.collision.TrajectorySystem
+function obe.scene._Scene:get_trajectory_system() end
+
 ---@return obe.scene.SceneNode
 function obe.scene._Scene:get_scene_root_node() end
 
@@ -268,6 +273,16 @@ function obe.scene._Scene:get_render_options() end
 ---@param options obe.scene.SceneRenderOptions #
 function obe.scene._Scene:set_render_options(options) end
 
+--- Gets the counters of the culling pass of the last drawn frame
+---
+---@return obe.graphics.CullingStats
+function obe.scene._Scene:get_culling_stats() end
+
+--- Gets the counters of the SpriteBatch of the last drawn frame
+---
+---@return obe.graphics.SpriteBatchStats
+function obe.scene._Scene:get_sprite_batch_stats() end
+
 ---@param id string #
 ---@return obe.component.ComponentBase
 function obe.scene._Scene:get_component(id) end
@@ -312,6 +327,8 @@ function obe.scene._SceneNode:move_without_children(position) end
 ---@field sprites boolean #
 ---@field collisions boolean #
 ---@field scene_nodes boolean #
+---@field culling boolean #
+---@field batching boolean #
 obe.scene._SceneRenderOptions = {};
 
 
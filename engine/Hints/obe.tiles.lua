@@ -70,6 +70,16 @@ function obe.tiles._TileLayer:set_tile(x, y, tile_id) end
 ---@return number
 function obe.tiles._TileLayer:get_tile(x, y) end
 
+--- Amount of vertices allocated by all the chunks of the TileLayer
+---
+---@return number
+function obe.tiles._TileLayer:get_vertex_count() end
+
+--- Amount of vertices submitted by the last call to draw
+---
+---@return number
+function obe.tiles._TileLayer:get_drawn_vertex_count() end
+
 
 ---@class obe.tiles.TileScene : obe.types.Serializable
 obe.tiles._TileScene = {};
@@ -131,6 +141,18 @@ function obe.tiles._TileScene:get_collider_models() end
 ---@return vili.node[]
 function obe.tiles._TileScene:get_game_objects_models() end
 
+--- Gets the animation of a tile
+---
+---@param tile_id number #Id of the tile (without flip flags)
+---@return obe.tiles.AnimatedTile
+function obe.tiles._TileScene:get_animated_tile(tile_id) end
+
+--- Gets the collider model of a tile
+---
+---@param tile_id number #Id of the tile (without flip flags)
+---@return obe.collision.ColliderComponent
+function obe.tiles._TileScene:get_collider_model(tile_id) end
+
 ---@return number
 function obe.tiles._TileScene:get_width() end
 
@@ -146,6 +168,9 @@ function obe.tiles._TileScene:get_tile_height() end
 ---@return boolean
 function obe.tiles._TileScene:is_anti_aliased() end
 
+---@return boolean
+function obe.tiles._TileScene:is_merging_colliders() end
+
 ---@return obe.scene.Scene
 function obe.tiles._TileScene:get_scene() end
 
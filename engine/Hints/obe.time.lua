@@ -145,6 +145,40 @@ function obe.time._FramerateManager:set_max_delta_time(max_delta_time) end
 ---@return obe.time.TimeUnit
 function obe.time.epoch() end
 
+--- Get the amount of seconds elapsed on a monotonic clock, only meaningful when compared to another value of the same clock.
+---
+---@return obe.time.TimeUnit
+function obe.time.monotonic() end
+
+--- Get the timestamp of the current frame, the frame clock is only sampled by advance_frame so every subsystem sees the same time during a frame.
+---
+---@return obe.time.TimeUnit
+function obe.time.now() end
+
+--- Get the amount of frames started since the engine started.
+---
+---@return number
+function obe.time.get_frame_index() end
+
+--- Get the timestamp a frame starting right now would have, on a virtual clock it is always one step after the current frame.
+---
+---@return obe.time.TimeUnit
+function obe.time.get_next_frame_time() end
+
+--- Samples the frame clock for a new frame (done by the FramerateManager every time a frame is due)
+---
+function obe.time.advance_frame() end
+
+--- Makes the frame clock virtual, every frame then lasts exactly `step` seconds regardless of the time it actually took (for replays and benchmarks)
+---
+---@param step obe.time.TimeUnit #Duration of a frame in seconds, 0 to go back to the monotonic clock
+function obe.time.set_virtual_clock(step) end
+
+--- Get if the frame clock is virtual or not.
+---
+---@return boolean
+function obe.time.is_clock_virtual() end
+
 
 ---@type obe.time.TimeUnit
 obe.time.seconds = {};
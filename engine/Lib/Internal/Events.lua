@@ -6,6 +6,8 @@ local function merge_tables(t1, t2)
 end
 
 local function EventHook(listener_id, namespace, group, event, callback)
+    -- Kept as an upvalue so dispatching an event does not look the hook metatable up
+    local receive_wrapper = nil;
     local hook_mt = {
         __call = function(object, ...)
             local mt = getmetatable(object);
@@ -29,6 +31,7 @@ local function EventHook(listener_id, namespace, group, event, callback)
         configure = function(self, config)
             self.event_emit_wrapper = config.event_emit_wrapper;
             self.event_receive_wrapper = config.event_receive_wrapper;
+            receive_wrapper = config.event_receive_wrapper;
         end,
         event_namespace = namespace,
         event_group = group,
@@ -39,11 +42,12 @@ local function EventHook(listener_id, namespace, group, event, callback)
         event_receive_wrapper = nil
     };
     local event_hook = setmetatable({callback = callback}, hook_mt);
-    local receive_wrapper_caller = function(...)
-        if hook_mt.event_receive_wrapper then
-            return hook_mt.event_receive_wrapper(event_hook, ...);
+    -- Events only carry one payload, avoids packing varargs on every call
+    local receive_wrapper_caller = function(evt)
+        if receive_wrapper then
+            return receive_wrapper(event_hook, evt);
         end
-        return callback(...);
+        return callback(evt);
     end
     local lua_listener = obe.event.LuaEventListener(receive_wrapper_caller);
     Engine.Events:get_namespace(namespace)
@@ -0,0 +1,75 @@
+---@class Benchmark : GameObjectCls
+local Benchmark = GameObject();
+
+-- Amount of Tickers listening to Game.Update for each stage, the first one is the baseline
+local STAGES = {0, 100, 500, 1000};
+local WARMUP_FRAMES = 30;
+local MEASURED_FRAMES = 240;
+
+local stage = 0;
+local frame = 0;
+local tickers = {};
+local update_start;
+local total_time = 0;
+local baseline;
+
+local function spawn_tickers(amount)
+    for _, ticker_id in ipairs(tickers) do
+        Engine.Scene:remove_game_object(ticker_id);
+    end
+    tickers = {};
+    for i = 1, amount do
+        local ticker_id = ("ticker_%d"):format(i);
+        Engine.Scene:create_game_object("Ticker", ticker_id);
+        tickers[i] = ticker_id;
+    end
+end
+
+local function next_stage()
+    stage = stage + 1;
+    frame = 0;
+    total_time = 0;
+    if STAGES[stage] then
+        spawn_tickers(STAGES[stage]);
+    else
+        spawn_tickers(0);
+        obe.debug.info("<EventBenchmark> Done");
+        Engine.Window:close();
+    end
+end
+
+local function report(amount, frame_time)
+    if not baseline then
+        baseline = frame_time;
+        obe.debug.info(("<EventBenchmark> Baseline : %.2f us per frame"):format(frame_time * 1e6));
+        return;
+    end
+    local per_object = (frame_time - baseline) / amount;
+    obe.debug.info(("<EventBenchmark> %d objects : %.2f us per frame, %.3f us per object"):format(
+        amount, frame_time * 1e6, per_object * 1e6
+    ));
+end
+
+function Benchmark:init()
+    next_stage();
+end
+
+-- Benchmark listens to Game.Update before every Ticker, the time spent until Game.Render
+-- covers all of their listeners
+function Event.Game.Update()
+    update_start = obe.time.monotonic();
+end
+
+function Event.Game.Render()
+    if not STAGES[stage] or not update_start then
+        return;
+    end
+    frame = frame + 1;
+    if frame > WARMUP_FRAMES then
+        total_time = total_time + (obe.time.monotonic() - update_start);
+    end
+    if frame == WARMUP_FRAMES + MEASURED_FRAMES then
+        report(STAGES[stage], total_time / MEASURED_FRAMES);
+        next_stage();
+    end
+end
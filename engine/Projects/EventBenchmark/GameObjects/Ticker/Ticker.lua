@@ -0,0 +1,8 @@
+---@class Ticker : GameObjectCls
+local Ticker = GameObject();
+
+local elapsed = 0;
+
+function Event.Game.Update(evt)
+    elapsed = elapsed + evt.dt;
+end
@@ -0,0 +1,3 @@
+function Game.Start()
+    Engine.Scene:load_from_file("scenes://benchmark.map.vili");
+end
@@ -206,6 +206,7 @@ namespace obe::animation
         void load_code(const vili::node& code);
 
         [[nodiscard]] const graphics::Texture& load_texture(const std::string& local_path);
+        [[nodiscard]] graphics::TexturePart load_texture_part(const std::string& local_path);
 
         friend class AnimationState;
 
@@ -15,10 +15,14 @@ namespace obe::collision::bindings
     void load_class_complex_polygon_collider(sol::state_view state);
     void load_class_polygon_collider(sol::state_view state);
     void load_class_quadtree(sol::state_view state);
+    void load_class_quadtree_stats(sol::state_view state);
+    void load_class_spatial_hash_grid(sol::state_view state);
     void load_class_rectangle_collider(sol::state_view state);
     void load_class_trajectory(sol::state_view state);
     void load_class_trajectory_node(sol::state_view state);
+    void load_class_trajectory_system(sol::state_view state);
     void load_class_collision_rejection_pair(sol::state_view state);
     void load_enum_collider_type(sol::state_view state);
+    void load_enum_broadphase_type(sol::state_view state);
     void load_function_collider_type_to_c2type(sol::state_view state);
 };
\ No newline at end of file
@@ -6,5 +6,8 @@ namespace sol
 };
 namespace obe::events::Scene::bindings
 {
+    void load_class_collision_begin(sol::state_view state);
+    void load_class_collision_end(sol::state_view state);
+    void load_class_collision_stay(sol::state_view state);
     void load_class_loaded(sol::state_view state);
 };
\ No newline at end of file
@@ -10,6 +10,13 @@ namespace obe::time::bindings
     void load_class_framerate_counter(sol::state_view state);
     void load_class_framerate_manager(sol::state_view state);
     void load_function_epoch(sol::state_view state);
+    void load_function_monotonic(sol::state_view state);
+    void load_function_now(sol::state_view state);
+    void load_function_get_frame_index(sol::state_view state);
+    void load_function_get_next_frame_time(sol::state_view state);
+    void load_function_advance_frame(sol::state_view state);
+    void load_function_set_virtual_clock(sol::state_view state);
+    void load_function_is_clock_virtual(sol::state_view state);
     void load_global_seconds(sol::state_view state);
     void load_global_milliseconds(sol::state_view state);
     void load_global_microseconds(sol::state_view state);
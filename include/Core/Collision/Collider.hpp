@@ -1,15 +1,19 @@
 #pragma once
 
+#include <span>
 #include <unordered_set>
 
 #include <cute/cute_c2.h>
 
+#include <Collision/ColliderTags.hpp>
 #include <Transform/AABB.hpp>
 #include <Types/SmartEnum.hpp>
 
 namespace obe::collision
 {
     class Collider;
+    class ColliderComponent;
+    class CollisionSpace;
 
     /**
      * \brief Struct containing data of a collision applied to a collider
@@ -47,13 +51,34 @@ namespace obe::collision
     class Collider : public transform::Movable
     {
     private:
-        std::string m_tag;
+        ColliderTagId m_tag = 0;
+        // Broadphase bookkeeping, owned by the CollisionSpace the Collider was added to
+        mutable CollisionSpace* m_collision_space = nullptr;
+        mutable bool m_dirty = false;
 
+        friend class ColliderComponent;
         friend class CollisionSpace;
 
     protected:
         [[nodiscard]] virtual const void* get_c2_shape() const = 0;
         [[nodiscard]] virtual const c2x* get_c2_space_transform() const = 0;
+        /**
+         * \brief Gets the convex pieces of a Collider that cute_c2 cannot represent
+         *        with a single shape, they are used when get_c2_shape gives nullptr
+         */
+        [[nodiscard]] virtual std::span<const c2Poly> get_c2_pieces() const;
+        /**
+         * \brief Calls callback(shape, type) with the cute_c2 shape of the Collider or
+         *        with each of its convex pieces, until the callback returns false
+         * \return false if the callback stopped the iteration
+         */
+        template <class Callback>
+        bool for_each_c2_shape(Callback&& callback) const;
+        /**
+         * \brief Signals the CollisionSpace holding the Collider that its bounding box
+         *        changed, it is moved in the broadphase before the next query
+         */
+        void invalidate_bounding_box();
 
     public:
         /**
@@ -64,7 +89,20 @@ namespace obe::collision
 
         Collider() = default;
         explicit Collider(const transform::UnitVector& position);
-        ~Collider() override = default;
+        /**
+         * \brief Copies the shape and tag of a Collider, the copy is not part of any
+         *        CollisionSpace
+         */
+        Collider(const Collider& other);
+        /**
+         * \brief Copies the shape and tag of a Collider, the Collider stays in its
+         *        CollisionSpace
+         */
+        Collider& operator=(const Collider& other);
+        /**
+         * \brief Removes the Collider from its CollisionSpace
+         */
+        ~Collider() override;
 
         // Tags
         /**
@@ -78,6 +116,11 @@ namespace obe::collision
          *         the chosen List
          */
         [[nodiscard]] std::string get_tag() const;
+        /**
+         * \nobind
+         * \brief Gets the interned id of the Collider's Tag
+         */
+        [[nodiscard]] ColliderTagId get_tag_id() const;
 
         /**
          * \brief Checks if two polygons are intersecting
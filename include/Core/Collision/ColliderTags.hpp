@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace obe::collision
+{
+    /**
+     * \brief Id of an interned Collider tag, the empty tag always has the id 0
+     */
+    using ColliderTagId = std::uint32_t;
+
+    /**
+     * \nobind
+     * \brief Interns Collider tags into small integer ids shared by all the
+     *        CollisionSpaces so tag filtering never hashes strings
+     */
+    class ColliderTags
+    {
+    private:
+        std::deque<std::string> m_names;
+        std::unordered_map<std::string, ColliderTagId> m_ids;
+        mutable std::mutex m_mutex;
+
+        ColliderTags();
+        static ColliderTags& instance();
+
+    public:
+        /**
+         * \brief Gets the id of a tag, interning it if it was never seen before
+         * \param name Name of the tag
+         * \return The id of the tag
+         */
+        static ColliderTagId get_id(const std::string& name);
+        /**
+         * \brief Gets the name of an interned tag
+         * \param id Id returned by get_id
+         * \return The name of the tag
+         */
+        static const std::string& get_name(ColliderTagId id);
+    };
+}
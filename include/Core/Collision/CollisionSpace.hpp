@@ -1,9 +1,14 @@
 #pragma once
 
+#include <memory>
 #include <unordered_map>
+#include <variant>
 
 #include <Collision/Collider.hpp>
 #include <Collision/Quadtree.hpp>
+#include <Collision/SpatialHashGrid.hpp>
+#include <Types/SmartEnum.hpp>
+#include <Utils/ThreadPool.hpp>
 
 namespace obe::collision
 {
@@ -18,20 +23,120 @@ namespace obe::collision
         }
     };
 
+    /**
+     * \brief Structure used by a CollisionSpace to find the Colliders close to each
+     *        other
+     */
+    enum class BroadphaseType
+    {
+        /**
+         * \brief Quadtree fitted around the Colliders, suited to Colliders of
+         *        varied sizes
+         */
+        Quadtree,
+        /**
+         * \brief Uniform grid of cells, suited to dense scenes of similarly sized
+         *        Colliders
+         */
+        SpatialHashGrid
+    };
+    using BroadphaseTypeMeta = types::SmartEnum<BroadphaseType>;
+
     using ReachableCollider = std::pair<const Collider*, transform::UnitVector>;
+    /**
+     * \brief Two colliding Colliders, the Collider with the lowest address comes first
+     */
+    using CollisionPair = std::pair<const Collider*, const Collider*>;
+
+    /**
+     * \brief A Collider and the offset it wants to travel, used for batched queries
+     */
+    struct CollisionQuery
+    {
+        const Collider* collider = nullptr;
+        transform::UnitVector offset;
+    };
+
+    /**
+     * \brief Contacts between Colliders compared to the previous call to
+     *        CollisionSpace::update_contacts
+     */
+    struct ContactChanges
+    {
+        /**
+         * \brief Pairs of Colliders that started colliding
+         */
+        std::vector<CollisionPair> began;
+        /**
+         * \brief Pairs of Colliders that were already colliding
+         */
+        std::vector<CollisionPair> stayed;
+        /**
+         * \brief Pairs of Colliders that stopped colliding
+         */
+        std::vector<CollisionPair> ended;
+    };
 
+    /**
+     * \brief Holds Colliders in a broadphase to accelerate collision queries
+     *
+     * Colliders signal the CollisionSpace when they move, the moved Colliders are
+     * reinserted in the broadphase all at once by update() or before the next query.
+     * The broadphase is either a Quadtree or a SpatialHashGrid (see BroadphaseType).
+     * The Quadtree covers the area around the Colliders, it is refitted on rebuilds
+     * and grows whenever a Collider leaves it.
+     * A Collider belongs to at most one CollisionSpace at a time.
+     */
     class CollisionSpace
     {
     private:
-        std::unordered_set<const Collider*> m_colliders;
+        // Bounding box each Collider was inserted with in the broadphase
+        mutable std::unordered_map<const Collider*, transform::AABB> m_colliders;
         std::unordered_map<std::string, std::unordered_set<std::string>> m_tags_blacklists;
-        Quadtree m_quadtree;
+        // Rejected tag ids of each source tag id as bitsets, 64 tags per word
+        std::vector<std::vector<std::uint64_t>> m_blacklist_masks;
+        std::size_t m_quadtree_threshold = Quadtree::DefaultThreshold;
+        std::size_t m_quadtree_max_depth = Quadtree::DefaultMaxDepth;
+        double m_grid_cell_size = SpatialHashGrid::DefaultCellSize;
+        mutable std::variant<Quadtree, SpatialHashGrid> m_broadphase;
+        mutable std::vector<const Collider*> m_dirty_colliders;
+        // Sorted pairs found by the last call to update_contacts
+        std::vector<CollisionPair> m_contacts;
+        // Workers sharing narrowphase tests of batched queries, serial when empty
+        std::unique_ptr<utils::ThreadPool> m_narrowphase_pool;
+
+        /**
+         * \brief Marks a Collider as moved, it is reinserted in the broadphase before
+         *        the next query
+         */
+        void invalidate_collider(const Collider* collider);
+        /**
+         * \brief Moves a Collider to its new place in the broadphase
+         * \return false if the Collider left the Quadtree, which has to be rebuilt
+         */
+        bool reinsert_collider(const Collider* collider) const;
+        void rebuild_broadphase() const;
+        [[nodiscard]] bool broadphase_covers(const transform::AABB& box) const;
+        template <class Visitor>
+        void visit_broadphase(const transform::AABB& box, Visitor&& visitor) const;
+        void update_dirty_colliders() const;
+        void set_tag_rejected(ColliderTagId source_tag, ColliderTagId rejected_tag, bool rejected);
+        [[nodiscard]] bool is_tag_rejected(ColliderTagId source_tag, ColliderTagId rejected_tag) const;
+        template <class Visitor>
+        void visit_reachable_colliders(const Collider& collider,
+            const transform::UnitVector& offset, Visitor&& visitor) const;
+        void find_reachable_colliders(const Collider& collider,
+            const transform::UnitVector& offset,
+            std::vector<ReachableCollider>& reachable_colliders) const;
+
+        friend class Collider;
     protected:
         static bool matches_any_tag(const std::unordered_set<std::string>& input_tags,
             const std::unordered_set<std::string>& whitelist_or_blacklist);
         bool can_collide_with(const Collider& collider1, const Collider& collider2, bool check_both_directions = true) const;
     public:
         CollisionSpace();
+        ~CollisionSpace();
 
         /**
          * \brief Adds a Collider in the CollisionSpace
@@ -54,9 +159,20 @@ namespace obe::collision
          * \param collider Pointer to the collider to remove from the CollisionSpace
          */
         void remove_collider(const Collider* collider);
+        /**
+         * \brief Reinserts a Collider in the broadphase right away
+         * \param collider Pointer to the collider to reinsert
+         */
         void refresh_collider(const Collider* collider);
-
+        /**
+         * \brief Rebuilds the broadphase from all the Colliders of the CollisionSpace
+         */
         void refresh_quadtree();
+        /**
+         * \brief Reinserts all the Colliders that moved since the last update in the
+         *        broadphase
+         */
+        void update();
 
         [[nodiscard]] bool collides(const Collider& collider) const;
         [[nodiscard]] transform::UnitVector get_offset_before_collision(const Collider& collider,
@@ -67,6 +183,97 @@ namespace obe::collision
             = transform::UnitVector(0, 0)) const;
         std::vector<ReachableCollider> get_reachable_colliders(const Collider& collider,
             const transform::UnitVector& offset = transform::UnitVector(0, 0)) const;
+        /**
+         * \nobind
+         * \brief Runs get_reachable_colliders for a batch of probes, spreading the
+         *        narrowphase over the narrowphase workers
+         * \param queries Colliders to test along with their offsets, they must not move
+         *        until the function returns
+         * \return The reachable Colliders of each query, in the order of the queries
+         */
+        [[nodiscard]] std::vector<std::vector<ReachableCollider>> get_reachable_colliders(
+            const std::vector<CollisionQuery>& queries) const;
+        /**
+         * \nobind
+         * \brief Same as get_reachable_colliders but writes into a buffer, reusing its
+         *        capacity so steady-state queries do not allocate
+         * \param collider Collider to test
+         * \param offset Offset the Collider wants to travel
+         * \param reachable_colliders Buffer receiving the reachable Colliders, it is
+         *        cleared first
+         */
+        void get_reachable_colliders(const Collider& collider,
+            const transform::UnitVector& offset,
+            std::vector<ReachableCollider>& reachable_colliders) const;
+        /**
+         * \nobind
+         * \brief Same as the batched get_reachable_colliders but writes into a buffer,
+         *        reusing the capacity of each list of the previous call
+         */
+        void get_reachable_colliders(const std::vector<CollisionQuery>& queries,
+            std::vector<std::vector<ReachableCollider>>& reachable_colliders) const;
+        /**
+         * \nobind
+         * \brief Finds all the pairs of Colliders that collide in a single pass
+         *        (broadphase then narrowphase, blacklisted tags are skipped)
+         * \return A std::vector of all the colliding pairs, sorted
+         */
+        [[nodiscard]] std::vector<CollisionPair> get_all_collisions() const;
+        /**
+         * \nobind
+         * \brief Finds all the colliding pairs and compares them with the ones found
+         *        by the previous call
+         * \return The pairs that began, stayed or ended colliding since the previous call
+         */
+        ContactChanges update_contacts();
+        /**
+         * \nobind
+         * \brief Forgets the contacts found by update_contacts, the next call reports
+         *        every colliding pair as new
+         */
+        void reset_contacts();
+        /**
+         * \brief Sets how many worker threads share the narrowphase of batched queries
+         *        (get_all_collisions and batched get_reachable_colliders)
+         * \param workers Amount of worker threads, 0 runs the narrowphase on the
+         *        calling thread only
+         */
+        void set_narrowphase_workers(std::size_t workers);
+        [[nodiscard]] std::size_t get_narrowphase_workers() const;
+        /**
+         * \brief Sets when the nodes of the Quadtree broadphase are split, the Quadtree
+         *        is rebuilt with the new limits if it is in use
+         * \param threshold Amount of Colliders a leaf holds before being split
+         * \param max_depth Depth past which leaves are never split
+         */
+        void set_quadtree_limits(std::size_t threshold, std::size_t max_depth);
+        /**
+         * \brief Switches to another broadphase, the Colliders are inserted in the new
+         *        one right away
+         * \param type Broadphase to use from now on
+         */
+        void set_broadphase(BroadphaseType type);
+        [[nodiscard]] BroadphaseType get_broadphase() const;
+        /**
+         * \brief Sets the side of the cells of the SpatialHashGrid broadphase, it is
+         *        rebuilt if it is in use
+         * \param cell_size Side of the cells, ideally close to the size of the
+         *        Colliders
+         */
+        void set_grid_cell_size(double cell_size);
+        [[nodiscard]] double get_grid_cell_size() const;
+        /**
+         * \brief Gets the area covered by the Quadtree broadphase, the SpatialHashGrid
+         *        is unbounded and gives an empty AABB
+         */
+        [[nodiscard]] transform::AABB get_bounds() const;
+        /**
+         * \brief Gets the depth and leaf occupancy of the Quadtree broadphase, empty
+         *        stats are given when the SpatialHashGrid is in use
+         */
+        [[nodiscard]] QuadtreeStats get_quadtree_stats() const;
+        [[nodiscard]] std::size_t get_quadtree_threshold() const;
+        [[nodiscard]] std::size_t get_quadtree_max_depth() const;
 
         void add_tag_to_blacklist(const std::string& source_tag, const std::string& rejected_tag);
         void remove_tag_to_blacklist(
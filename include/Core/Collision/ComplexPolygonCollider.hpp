@@ -6,13 +6,28 @@
 
 namespace obe::collision
 {
+    /**
+     * \brief Collider made of any simple polygon, convex or not
+     *
+     * The polygon is decomposed into convex pieces whenever a point is added, so
+     * it collides with every other type of Collider through cute_c2. The pieces and
+     * the bounding box only move along with the polygon afterwards.
+     */
     class ComplexPolygonCollider : public Collider
     {
     private:
         std::vector<transform::UnitVector> m_points;
+        // Convex pieces of the polygon, relative to its first point
+        std::vector<c2Poly> m_pieces;
+        c2x m_transform = c2xIdentity();
+        transform::AABB m_bounding_box;
+
+        void update_pieces();
+
     protected:
         [[nodiscard]] const void* get_c2_shape() const override;
         [[nodiscard]] const c2x* get_c2_space_transform() const override;
+        [[nodiscard]] std::span<const c2Poly> get_c2_pieces() const override;
 
     public:
         static constexpr ColliderType Type = ColliderType::ComplexPolygon;
@@ -36,25 +51,16 @@ namespace obe::collision
          * \return The amount of points in the Polygon
          */
         [[nodiscard]] std::size_t get_points_amount() const;
-
         /**
-         * \brief Checks if two polygons are intersecting
-         * \param collider The other collider to test
-         * \param offset The offset to apply to the source collider
-         * \return true if the two polygons intersects, false otherwise
+         * \brief Gets all the points of the Polygon
+         * \return The points of the Polygon (in SceneUnits)
          */
-        [[nodiscard]] bool collides(const Collider& collider) const override;
+        [[nodiscard]] const std::vector<transform::UnitVector>& get_points() const;
         /**
-         * \brief Gets the Maximum distance before Collision with a specific
-         *        Collider
-         * \param collider Collider to check the Collision with
-         * \param offset Distance the Collider should move to (if nothing collides)
-         * \return The maximum distance the Collider can travel before colliding
+         * \brief Gets the number of convex pieces the Polygon was decomposed into
+         * \return The amount of convex pieces, 0 until the Polygon has 3 points
          */
-        [[nodiscard]] transform::UnitVector get_offset_before_collision(
-            const Collider& collider,
-            const transform::UnitVector& self_offset = transform::UnitVector(0, 0),
-            const transform::UnitVector& other_offset = transform::UnitVector(0, 0)) const override;
+        [[nodiscard]] std::size_t get_pieces_amount() const;
 
         // Inherited via Collider
         virtual transform::AABB get_bounding_box() const override;
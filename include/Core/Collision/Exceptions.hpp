@@ -75,4 +75,41 @@ namespace obe::collision::exceptions
             this->error("Trajectory with name '{}' already exists", trajectory_name);
         }
     };
+
+    class UnknownTrajectory : public Exception<UnknownTrajectory>
+    {
+    public:
+        using Exception::Exception;
+        UnknownTrajectory(std::string_view trajectory_name,
+            std::source_location location = std::source_location::current())
+            : Exception(location)
+        {
+            this->error("Trajectory with name '{}' does not exist", trajectory_name);
+        }
+    };
+
+    class InvalidQuadtreeThreshold : public Exception<InvalidQuadtreeThreshold>
+    {
+    public:
+        using Exception::Exception;
+        InvalidQuadtreeThreshold(std::source_location location = std::source_location::current())
+            : Exception(location)
+        {
+            this->error("Tried to set the Quadtree split threshold to 0");
+            this->hint("Leaves need to hold at least one Collider before being split");
+        }
+    };
+
+    class InvalidGridCellSize : public Exception<InvalidGridCellSize>
+    {
+    public:
+        using Exception::Exception;
+        InvalidGridCellSize(
+            double cell_size, std::source_location location = std::source_location::current())
+            : Exception(location)
+        {
+            this->error("Tried to set the SpatialHashGrid cell size to {}", cell_size);
+            this->hint("Cells need a strictly positive size");
+        }
+    };
 } // namespace obe::collision::exceptions
@@ -1,7 +1,8 @@
 #pragma once
 
-#include <array>
-#include <memory>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 #include <vector>
 
 #include <Collision/Collider.hpp>
@@ -9,43 +10,186 @@
 
 namespace obe::collision
 {
+    /**
+     * \brief How the values of a Quadtree are spread over its nodes
+     */
+    struct QuadtreeStats
+    {
+        /**
+         * \brief Amount of nodes in use, interior nodes and leaves
+         */
+        std::size_t nodes = 0;
+        std::size_t leaves = 0;
+        /**
+         * \brief Depth of the deepest leaf, 0 when the root was never split
+         */
+        std::size_t depth = 0;
+        std::size_t values = 0;
+        /**
+         * \brief Amount of values held by interior nodes because they straddle the
+         *        boundaries of their children
+         */
+        std::size_t interior_values = 0;
+        std::size_t max_leaf_values = 0;
+        double average_leaf_values = 0;
+    };
+
+    /**
+     * \brief Quadtree storing its nodes in a single contiguous pool
+     *
+     * The four children of a node are consecutive in the pool and referenced by the
+     * index of the first one. Blocks of children freed by merges go to a free list and
+     * are reused by the next splits, keeping the capacity of their value buffers.
+     */
     class Quadtree
     {
+    public:
+        static constexpr auto DefaultThreshold = std::size_t(16);
+        static constexpr auto DefaultMaxDepth = std::size_t(8);
+
     private:
-        static constexpr auto Threshold = std::size_t(16);
-        static constexpr auto MaxDepth = std::size_t(8);
+        using NodeIndex = std::uint32_t;
+        static constexpr NodeIndex NoChildren = std::numeric_limits<NodeIndex>::max();
+
+        /**
+         * \brief A Collider stored in the Quadtree along with the bounding box it was
+         *        inserted with
+         */
+        struct Entry
+        {
+            const Collider* value;
+            transform::AABB box;
+        };
 
         struct Node
         {
-            std::array<std::unique_ptr<Node>, 4> children;
-            std::vector<const Collider*> values;
+            // Index of the first of the four children, NoChildren for leaves
+            NodeIndex children = NoChildren;
+            std::vector<Entry> values;
         };
 
         transform::AABB m_box;
-        std::unique_ptr<Node> m_root;
+        std::size_t m_threshold;
+        std::size_t m_max_depth;
+        std::vector<Node> m_nodes;
+        std::vector<NodeIndex> m_free_children;
 
     protected:
-        bool is_leaf(const Node* node) const;
+        bool is_leaf(NodeIndex node) const;
         transform::AABB compute_box(const transform::AABB& box, int i) const;
-        int get_quadrant(const transform::AABB& nodeBox, const transform::AABB& valueBox) const;
-        void add_internal(Node* node, std::size_t depth, const transform::AABB& box, const Collider* value);
-        void split(Node* node, const transform::AABB& box);
-        bool remove_internal(Node* node, const transform::AABB& box, const Collider* value);
-        void remove_value(Node* node, const Collider* value);
-        bool try_merge(Node* node);
-        void query_internal(Node* node, const transform::AABB& box, const transform::AABB& query_box, std::vector<const Collider*>& values) const;
-        void find_all_intersections_internal(Node* node, std::vector<std::pair<const Collider*, const Collider*>>& intersections) const;
-        void find_intersections_in_descendants(Node* node, const Collider* value,
+        int get_quadrant(const transform::AABB& node_box, const transform::AABB& value_box) const;
+        NodeIndex allocate_children();
+        void add_internal(NodeIndex node, std::size_t depth, const transform::AABB& box, const Entry& entry);
+        void split(NodeIndex node, const transform::AABB& box);
+        bool remove_internal(NodeIndex node, const transform::AABB& box, const Entry& entry);
+        void remove_value(NodeIndex node, const Collider* value);
+        bool try_merge(NodeIndex node);
+        template <class Visitor>
+        bool visit_internal(NodeIndex node, const transform::AABB& box,
+            const transform::AABB& query_box, Visitor& visitor) const;
+        void find_all_intersections_internal(NodeIndex node, std::vector<std::pair<const Collider*, const Collider*>>& intersections) const;
+        void find_intersections_in_descendants(NodeIndex node, const Entry& entry,
             std::vector<std::pair<const Collider*, const Collider*>>& intersections) const;
+        void collect_stats(NodeIndex node, std::size_t depth, QuadtreeStats& stats) const;
 
     public:
-        Quadtree(const transform::AABB& box);
+        /**
+         * \brief Creates a new Quadtree
+         * \param box Area covered by the Quadtree
+         * \param threshold Amount of values a leaf holds before being split
+         * \param max_depth Depth past which leaves are never split
+         */
+        Quadtree(const transform::AABB& box, std::size_t threshold = DefaultThreshold,
+            std::size_t max_depth = DefaultMaxDepth);
         void clear();
-        void add(const Collider* value);
-        void remove(const Collider* value);
+        /**
+         * \brief Removes all the values and makes the Quadtree cover a new area
+         * \param box New area covered by the Quadtree
+         */
+        void reset(const transform::AABB& box);
+        [[nodiscard]] const transform::AABB& get_box() const;
+        [[nodiscard]] std::size_t get_threshold() const;
+        [[nodiscard]] std::size_t get_max_depth() const;
+        /**
+         * \brief Inserts a Collider in the Quadtree
+         * \param value Collider to insert
+         * \param box Bounding box of the Collider, the Quadtree keeps it until the
+         *        Collider is removed
+         */
+        void add(const Collider* value, const transform::AABB& box);
+        /**
+         * \brief Removes a Collider from the Quadtree
+         * \param value Collider to remove
+         * \param box Bounding box the Collider was inserted with, which may differ
+         *        from its current one if it moved since
+         */
+        void remove(const Collider* value, const transform::AABB& box);
         std::vector<const Collider*> query(const transform::AABB& box) const;
+        /**
+         * \brief Gets the Colliders whose bounding box intersects a given box
+         * \param box Box to query
+         * \param values Buffer receiving the Colliders, it is cleared first and keeps
+         *        its capacity between calls
+         */
+        void query(const transform::AABB& box, std::vector<const Collider*>& values) const;
+        /**
+         * \brief Calls a visitor with each Collider whose bounding box intersects a
+         *        given box, without allocating
+         * \param box Box to query
+         * \param visitor Callable taking a const Collider*, it can return false to
+         *        stop the query early
+         */
+        template <class Visitor>
+        void visit(const transform::AABB& box, Visitor&& visitor) const;
         std::vector<std::pair<const Collider*, const Collider*>> find_all_intersections() const;
+        /**
+         * \brief Finds all the pairs of Colliders whose bounding boxes intersect
+         * \param intersections Buffer receiving the pairs, it is cleared first and
+         *        keeps its capacity between calls
+         */
+        void find_all_intersections(
+            std::vector<std::pair<const Collider*, const Collider*>>& intersections) const;
+        /**
+         * \brief Walks the Quadtree to measure its depth and the occupancy of its leaves
+         */
+        [[nodiscard]] QuadtreeStats get_stats() const;
     };
 
+    template <class Visitor>
+    bool Quadtree::visit_internal(NodeIndex node, const transform::AABB& box,
+        const transform::AABB& query_box, Visitor& visitor) const
+    {
+        for (const auto& entry : m_nodes[node].values)
+        {
+            if (query_box.intersects(entry.box))
+            {
+                if constexpr (std::is_same_v<std::invoke_result_t<Visitor&, const Collider*>, bool>)
+                {
+                    if (!visitor(entry.value))
+                        return false;
+                }
+                else
+                    visitor(entry.value);
+            }
+        }
+        if (!is_leaf(node))
+        {
+            const NodeIndex children = m_nodes[node].children;
+            for (auto i = NodeIndex(0); i < 4; ++i)
+            {
+                auto child_box = compute_box(box, static_cast<int>(i));
+                if (query_box.intersects(child_box)
+                    && !visit_internal(children + i, child_box, query_box, visitor))
+                    return false;
+            }
+        }
+        return true;
+    }
 
+    template <class Visitor>
+    void Quadtree::visit(const transform::AABB& box, Visitor&& visitor) const
+    {
+        if (box.intersects(m_box))
+            visit_internal(0, m_box, box, visitor);
+    }
 }
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <Collision/Collider.hpp>
+#include <Transform/AABB.hpp>
+
+namespace obe::collision
+{
+    /**
+     * \brief Broadphase hashing Colliders into a uniform grid of square cells
+     *
+     * Suited to dense scenes of similarly sized Colliders. Each Collider is stored in
+     * every cell its bounding box overlaps, the grid is unbounded and only the cells
+     * in use are allocated. Colliders overlapping too many cells are kept aside and
+     * tested against every query instead.
+     */
+    class SpatialHashGrid
+    {
+    public:
+        static constexpr double DefaultCellSize = 1;
+        static constexpr std::size_t MaxCellsPerValue = 16;
+
+    private:
+        using CellKey = std::uint64_t;
+
+        struct Entry
+        {
+            const Collider* value;
+            transform::AABB box;
+        };
+
+        struct CellRange
+        {
+            std::int32_t min_x;
+            std::int32_t min_y;
+            std::int32_t max_x;
+            std::int32_t max_y;
+            [[nodiscard]] std::size_t size() const;
+        };
+
+        double m_cell_size;
+        std::unordered_map<CellKey, std::vector<Entry>> m_cells;
+        // Empty cells are kept to reuse their buffers until they outnumber the others
+        std::size_t m_empty_cells = 0;
+        std::vector<Entry> m_large_values;
+
+    protected:
+        [[nodiscard]] std::int32_t to_cell(double coordinate) const;
+        [[nodiscard]] CellRange get_cells(const transform::AABB& box) const;
+        [[nodiscard]] static CellKey get_key(std::int32_t x, std::int32_t y);
+        /**
+         * \brief Gets the cell holding the top left corner of the intersection of two
+         *        boxes, values spanning several cells are only reported from there
+         */
+        [[nodiscard]] CellKey get_owner_cell(
+            const transform::AABB& box1, const transform::AABB& box2) const;
+        void prune_empty_cells();
+        template <class Report>
+        bool visit_cells(const transform::AABB& box, Report& report) const;
+
+    public:
+        /**
+         * \brief Creates a new SpatialHashGrid
+         * \param cell_size Side of the cells, ideally close to the size of the
+         *        Colliders it holds
+         */
+        explicit SpatialHashGrid(double cell_size = DefaultCellSize);
+        void clear();
+        [[nodiscard]] double get_cell_size() const;
+        /**
+         * \brief Inserts a Collider in the SpatialHashGrid
+         * \param value Collider to insert
+         * \param box Bounding box of the Collider, the SpatialHashGrid keeps it until
+         *        the Collider is removed
+         */
+        void add(const Collider* value, const transform::AABB& box);
+        /**
+         * \brief Removes a Collider from the SpatialHashGrid
+         * \param value Collider to remove
+         * \param box Bounding box the Collider was inserted with
+         */
+        void remove(const Collider* value, const transform::AABB& box);
+        std::vector<const Collider*> query(const transform::AABB& box) const;
+        void query(const transform::AABB& box, std::vector<const Collider*>& values) const;
+        /**
+         * \brief Calls a visitor once with each Collider whose bounding box intersects
+         *        a given box, without allocating
+         * \param box Box to query
+         * \param visitor Callable taking a const Collider*, it can return false to
+         *        stop the query early
+         */
+        template <class Visitor>
+        void visit(const transform::AABB& box, Visitor&& visitor) const;
+        std::vector<std::pair<const Collider*, const Collider*>> find_all_intersections() const;
+        void find_all_intersections(
+            std::vector<std::pair<const Collider*, const Collider*>>& intersections) const;
+    };
+
+    template <class Report>
+    bool SpatialHashGrid::visit_cells(const transform::AABB& box, Report& report) const
+    {
+        const auto visit_cell = [&](CellKey key, const std::vector<Entry>& entries) {
+            for (const Entry& entry : entries)
+            {
+                if (box.intersects(entry.box) && get_owner_cell(entry.box, box) == key
+                    && !report(entry.value))
+                    return false;
+            }
+            return true;
+        };
+        const CellRange range = get_cells(box);
+        // Large queries walk the cells in use rather than every cell they overlap
+        if (range.size() > m_cells.size())
+        {
+            for (const auto& [key, entries] : m_cells)
+            {
+                if (!visit_cell(key, entries))
+                    return false;
+            }
+            return true;
+        }
+        for (std::int32_t y = range.min_y; y <= range.max_y; ++y)
+        {
+            for (std::int32_t x = range.min_x; x <= range.max_x; ++x)
+            {
+                const CellKey key = get_key(x, y);
+                const auto cell = m_cells.find(key);
+                if (cell != m_cells.end() && !visit_cell(key, cell->second))
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    template <class Visitor>
+    void SpatialHashGrid::visit(const transform::AABB& box, Visitor&& visitor) const
+    {
+        const auto report = [&visitor](const Collider* value) {
+            if constexpr (std::is_same_v<std::invoke_result_t<Visitor&, const Collider*>, bool>)
+                return visitor(value);
+            else
+            {
+                visitor(value);
+                return true;
+            }
+        };
+        for (const Entry& entry : m_large_values)
+        {
+            if (box.intersects(entry.box) && !report(entry.value))
+                return;
+        }
+        visit_cells(box, report);
+    }
+}
@@ -44,10 +44,16 @@ namespace obe::collision
         ReachableColliderAcceptor m_reachable_collider_acceptor;
         double m_speed = 0;
         bool m_static = false;
+        double m_substep_length = 0;
         transform::Units m_unit;
         friend class TrajectoryNode;
 
     public:
+        /**
+         * \brief Maximum amount of substeps a Trajectory is split into in one update,
+         *        longer substeps are used past it
+         */
+        static constexpr std::size_t MaxSubsteps = 64;
         Trajectory(transform::Units unit = transform::Units::SceneUnits);
         Trajectory& add_acceleration(double acceleration);
         Trajectory& add_angle(double angle);
@@ -58,6 +64,7 @@ namespace obe::collision
         std::vector<TrajectoryCheckFunction>& get_checks();
         OnCollideCallback& get_on_collide_callback();
         [[nodiscard]] double get_speed() const;
+        [[nodiscard]] double get_substep_length() const;
         [[nodiscard]] bool is_static() const;
         [[nodiscard]] transform::Units get_unit() const;
         void on_collide(const OnCollideCallback& callback);
@@ -66,6 +73,16 @@ namespace obe::collision
         Trajectory& set_angle(double angle);
         Trajectory& set_speed(double speed);
         Trajectory& set_static(bool static_);
+        /**
+         * \brief Splits the movement of each update in substeps no longer than a given
+         *        length, each one checked for collisions on its own
+         * \param length Maximum length of a substep in the unit of the Trajectory, 0
+         *        moves by the whole offset at once
+         *
+         * Keeps the area searched for Colliders small for fast Trajectories
+         * and low framerates.
+         */
+        Trajectory& set_substep_length(double length);
 
         const ReachableColliderAcceptor& get_reachable_collider_acceptor() const;
         void set_reachable_collider_acceptor(const ReachableColliderAcceptor& acceptor);
@@ -4,10 +4,11 @@
 #include <Collision/CollisionSpace.hpp>
 #include <Collision/Trajectory.hpp>
 #include <Scene/SceneNode.hpp>
-#include <unordered_map>
 
 namespace obe::collision
 {
+    class TrajectorySystem;
+
     /**
      * \brief A Node containing trajectories, a SceneNode to drive and a probe to check
      * for collisions
@@ -15,19 +16,58 @@ namespace obe::collision
     class TrajectoryNode
     {
     private:
+        friend class TrajectorySystem;
+        struct TrajectoryEntry
+        {
+            std::string id;
+            std::unique_ptr<Trajectory> trajectory;
+        };
+
         CollisionSpace const* m_collision_space = nullptr;
         Collider* m_probe = nullptr;
         scene::SceneNode& m_scene_node;
-        std::unordered_map<std::string, std::unique_ptr<Trajectory>> m_trajectories {};
+        // Kept in insertion order, nodes rarely hold more than a few Trajectories
+        std::vector<TrajectoryEntry> m_trajectories {};
+        // Reused every update so steady-state collision queries do not allocate
+        mutable std::vector<ReachableCollider> m_reachable_colliders;
+        mutable std::vector<ReachableCollider> m_accepted_colliders;
+        TrajectorySystem* m_system = nullptr;
+        std::size_t m_system_index = 0;
+
+        /**
+         * \brief Gets how far the probe can travel along an offset before colliding
+         *        with a Collider accepted by the Trajectory
+         */
+        [[nodiscard]] transform::UnitVector get_offset_before_collision(Trajectory& trajectory,
+            const transform::UnitVector& offset,
+            std::vector<ReachableCollider>& reachable_colliders,
+            std::vector<ReachableCollider>& accepted_colliders) const;
+        void update(double dt, std::vector<ReachableCollider>& reachable_colliders,
+            std::vector<ReachableCollider>& accepted_colliders) const;
 
     public:
         explicit TrajectoryNode(scene::SceneNode& scene_node);
+        /**
+         * \brief Creates a new TrajectoryNode updated by a TrajectorySystem
+         * \param scene_node SceneNode driven by the Trajectories
+         * \param system TrajectorySystem updating the TrajectoryNode every frame
+         */
+        TrajectoryNode(scene::SceneNode& scene_node, TrajectorySystem& system);
+        TrajectoryNode(const TrajectoryNode&) = delete;
+        TrajectoryNode& operator=(const TrajectoryNode&) = delete;
+        ~TrajectoryNode();
         Trajectory& add_trajectory(
             const std::string& id, transform::Units unit = transform::Units::SceneUnits);
         [[nodiscard]] scene::SceneNode& get_scene_node() const;
         [[nodiscard]] Trajectory& get_trajectory(const std::string& id) const;
         void remove_trajectory(const std::string& id);
         void set_probe(CollisionSpace const* collision_space, Collider* probe);
+        /**
+         * \brief Gets the TrajectorySystem updating the TrajectoryNode
+         * \return A pointer to the TrajectorySystem or nullptr if the TrajectoryNode
+         *         is updated manually
+         */
+        [[nodiscard]] TrajectorySystem* get_system() const;
         void update(double dt) const;
     };
 } // namespace obe::collision
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <vector>
+
+#include <Collision/TrajectoryNode.hpp>
+#include <Types/Togglable.hpp>
+
+namespace obe::collision
+{
+    /**
+     * \brief Updates all of its TrajectoryNodes in a single pass every frame
+     *
+     * Replaces calling TrajectoryNode::update from the update hook of each GameObject,
+     * Lua is only called back when a Trajectory has checks, an acceptor or a callback
+     * to run. Nodes are updated in the order they were added.
+     */
+    class TrajectorySystem : public types::Togglable
+    {
+    private:
+        std::vector<TrajectoryNode*> m_nodes;
+        // Nodes removed while updating leave a hole, filled once the update is over
+        bool m_updating = false;
+        bool m_has_holes = false;
+        std::vector<ReachableCollider> m_reachable_colliders;
+        std::vector<ReachableCollider> m_accepted_colliders;
+
+        void compact();
+
+    public:
+        TrajectorySystem();
+        TrajectorySystem(const TrajectorySystem&) = delete;
+        TrajectorySystem& operator=(const TrajectorySystem&) = delete;
+        ~TrajectorySystem();
+        /**
+         * \brief Adds a TrajectoryNode to the TrajectorySystem, it is removed from its
+         *        previous TrajectorySystem if it had one
+         * \param node TrajectoryNode to update every frame
+         */
+        void add(TrajectoryNode& node);
+        void remove(TrajectoryNode& node);
+        /**
+         * \brief Removes all TrajectoryNodes driving a SceneNode, must be called before
+         *        the SceneNode is destroyed
+         * \param scene_node SceneNode being destroyed
+         */
+        void remove_nodes(const scene::SceneNode& scene_node);
+        void clear();
+        [[nodiscard]] bool contains(const TrajectoryNode& node) const;
+        [[nodiscard]] std::size_t get_nodes_amount() const;
+        /**
+         * \brief Updates every TrajectoryNode of the TrajectorySystem, does nothing
+         *        while the TrajectorySystem is disabled
+         * \param dt Delta time of the frame
+         */
+        void update(double dt);
+    };
+} // namespace obe::collision
@@ -1,10 +1,17 @@
 #pragma once
 
 #include <Event/EventGroup.hpp>
+#include <Graphics/Color.hpp>
 #include <Graphics/Font.hpp>
 #include <Graphics/Texture.hpp>
+#include <Graphics/TextureAtlas.hpp>
+#include <Utils/ThreadPool.hpp>
+#include <functional>
+#include <future>
 #include <memory>
+#include <optional>
 #include <unordered_map>
+#include <vector>
 
 namespace obe
 {
@@ -20,6 +27,8 @@ namespace obe::engine
     using ResourceStore = std::unordered_map<std::string, T>;
     using TexturePair
         = std::pair<std::unique_ptr<graphics::Texture>, std::unique_ptr<graphics::Texture>>;
+    using TextureLoadedCallback = std::function<void(const graphics::Texture&)>;
+    using FontLoadedCallback = std::function<void(std::shared_ptr<graphics::Font>)>;
     /**
      * \brief Class that manages and caches textures}
      */
@@ -29,9 +38,61 @@ namespace obe::engine
         event::EventGroupPtr e_resources;
         ResourceStore<std::shared_ptr<graphics::Font>> m_fonts;
         ResourceStore<TexturePair> m_textures;
+        std::unique_ptr<graphics::TextureAtlas> m_atlas;
+        std::unique_ptr<graphics::TextureAtlas> m_anti_aliased_atlas;
+
+        struct PendingTexture
+        {
+            std::string path;
+            std::string source;
+            bool anti_aliasing;
+            std::future<std::optional<sf::Image>> image;
+            std::vector<TextureLoadedCallback> callbacks;
+        };
+        struct PendingFont
+        {
+            std::string path;
+            std::future<std::unique_ptr<graphics::Font>> font;
+            std::vector<FontLoadedCallback> callbacks;
+        };
+        std::vector<PendingTexture> m_pending_textures;
+        std::vector<PendingFont> m_pending_fonts;
+        // Declared last so the workers are joined before the pending loads are destroyed
+        std::unique_ptr<utils::ThreadPool> m_loader_pool;
+
+        const graphics::Texture& store_texture(
+            const std::string& path, graphics::Texture texture, bool anti_aliasing);
+        utils::ThreadPool& get_loader_pool();
+        void finish_texture_loading(PendingTexture& pending);
+        void finish_font_loading(PendingFont& pending);
+        std::vector<PendingTexture>::iterator find_pending_texture(
+            const std::string& path, bool anti_aliasing);
+        std::vector<PendingFont>::iterator find_pending_font(const std::string& path);
 
     public:
         bool default_anti_aliasing;
+        /**
+         * \brief Packs small textures requested through get_texture_part into shared
+         *        atlas pages so Sprites using them can be batched together
+         */
+        bool use_texture_atlas = false;
+        /**
+         * \brief Width and height of the atlas pages (clamped to the maximum texture size)
+         */
+        uint32_t atlas_page_size = 2048;
+        /**
+         * \brief Textures wider or taller than this are never packed in the atlas
+         */
+        uint32_t atlas_max_image_size = 256;
+        /**
+         * \brief Maximum amount of asynchronously decoded textures uploaded to the GPU
+         *        per call to update (0 means no limit)
+         */
+        uint32_t async_uploads_per_update = 8;
+        /**
+         * \brief Color of the placeholder used by textures that are still loading
+         */
+        graphics::Color placeholder_color = graphics::Color(0, 0, 0, 0);
         ResourceManager();
         std::shared_ptr<graphics::Font> get_font(const std::string& path);
         /**
@@ -45,6 +106,57 @@ namespace obe::engine
          */
         const graphics::Texture& get_texture(const system::Path& path, bool anti_aliasing);
         const graphics::Texture& get_texture(const system::Path& path);
+        /**
+         * \brief Get the texture at the given path as a TexturePart.
+         *        When use_texture_atlas is enabled, small textures are packed in a
+         *        shared atlas page and the TexturePart only covers their region.
+         *        Otherwise the TexturePart covers the whole cached texture.
+         * \param path Relative of absolute path to the texture,
+         *        it uses the obe::System::Path loading system
+         * \param anti_aliasing Uses Anti-Aliasing for the texture when first loading it
+         * \return A TexturePart referencing the cached texture or atlas page
+         */
+        graphics::TexturePart get_texture_part(const system::Path& path, bool anti_aliasing);
+        graphics::TexturePart get_texture_part(const system::Path& path);
+        /**
+         * \brief Get the occupancy report of the texture atlas pages
+         *        (both anti-aliased and aliased pages are accounted)
+         */
+        [[nodiscard]] graphics::TextureAtlasStats get_atlas_stats() const;
+        /**
+         * \brief Starts loading the texture at the given path in the background.
+         *        The image is decoded by a worker thread and uploaded to the GPU
+         *        by update() on the main thread.
+         * \param path Relative of absolute path to the texture,
+         *        it uses the obe::System::Path loading system
+         * \param anti_aliasing Uses Anti-Aliasing for the texture when first loading it
+         * \param callback Function called on the main thread once the texture is ready
+         *        (immediately if the texture is already in cache)
+         * \return The cached texture, it displays a 1x1 placeholder until loaded.
+         *         Copies of it share the pixels so they are updated as well
+         */
+        const graphics::Texture& load_texture_async(const system::Path& path,
+            bool anti_aliasing, const TextureLoadedCallback& callback = {});
+        const graphics::Texture& load_texture_async(
+            const system::Path& path, const TextureLoadedCallback& callback = {});
+        /**
+         * \brief Starts loading the font at the given path in the background
+         * \param path Path to the font, it uses the obe::System::Path loading system
+         * \param callback Function called on the main thread once the font is ready
+         *        (immediately if the font is already in cache)
+         * \return The cached font, it stays empty until loaded
+         */
+        std::shared_ptr<graphics::Font> load_font_async(
+            const std::string& path, const FontLoadedCallback& callback = {});
+        /**
+         * \brief Uploads the textures and fonts decoded in the background and calls
+         *        their callbacks, the Engine calls it once per update
+         */
+        void update();
+        /**
+         * \brief Amount of textures and fonts still being loaded in the background
+         */
+        [[nodiscard]] std::size_t get_pending_loads() const;
 
         void clean();
     };
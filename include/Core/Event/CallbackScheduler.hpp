@@ -22,12 +22,18 @@ namespace obe::event
         time::TimeUnit m_after = 0;
         time::TimeUnit m_every = 0;
         time::TimeUnit m_start = 0;
+        time::TimeUnit m_deadline = 0;
         unsigned int m_times = 0;
         unsigned int m_current_times = 0;
         bool m_wait = false;
         bool m_repeat = false;
         CallbackSchedulerState m_state = CallbackSchedulerState::Standby;
-        void execute();
+        void execute(time::TimeUnit now);
+        /**
+         * \brief Gets the time at which the callback should be called next, infinity if
+         *        neither `after(x)` nor `every(x)` were configured
+         */
+        [[nodiscard]] time::TimeUnit get_deadline() const;
 
         friend class EventManager;
 
@@ -3,8 +3,8 @@
 #include <Debug/Logger.hpp>
 #include <Event/EventListener.hpp>
 #include <Event/Exceptions.hpp>
+#include <Event/ListenerStorage.hpp>
 #include <Time/TimeUtils.hpp>
-#include <map>
 
 namespace obe::event
 {
@@ -13,27 +13,35 @@ namespace obe::event
     class EventBase
     {
     private:
-        std::map<std::string, ExternalEventListener> m_listeners;
-        std::vector<std::string> m_garbage_collector;
+        ListenerStorage<ExternalEventListener> m_listeners;
 
     protected:
         std::string m_name;
         std::string m_identifier;
         bool m_triggered = false;
         bool m_enabled = true;
+        bool m_coalescing = false;
+        bool m_batched = false;
 
         OnListenerChange m_on_add_listener;
         OnListenerChange m_on_remove_listener;
 
         template <class EventType>
         void trigger(const EventType& event);
+        template <class EventType>
+        void trigger_batch(const std::vector<EventType>& events);
+        template <class PayloadType>
+        void trigger_lua_listeners(const PayloadType& payload);
+        /**
+         * \brief Delivers the events queued since the last flush
+         */
+        virtual void flush();
         template <class EventType, class ListenerType>
         void call_listener(
             const std::string& listener_id, ListenerType&& listener, const EventType& event);
         void on_add_listener(OnListenerChange callback);
         void on_remove_listener(OnListenerChange callback);
-        bool m_garbage_lock = false;
-        void collect_garbage();
+        void notify_removal(const std::optional<std::string>& removed_id) const;
 
         friend class EventGroup;
 
@@ -47,6 +55,7 @@ namespace obe::event
          */
         explicit EventBase(
             const std::string& parent_name, const std::string& name, bool initial_state = false);
+        virtual ~EventBase() = default;
         /**
          * \brief Get the State of the Event (enabled / disabled)
          * \return true if the Event is enabled, false otherwise
@@ -62,17 +71,49 @@ namespace obe::event
          * \return A std::string containing the name of the Event
          */
         [[nodiscard]] std::string get_identifier() const;
+        /**
+         * \brief Sets if queuing the Event replaces the event already queued since the
+         *        last flush instead of adding a new one (only used in queued EventGroups)
+         * \param coalescing true if only the last queued event should be delivered
+         */
+        void set_coalescing(bool coalescing);
+        [[nodiscard]] bool is_coalescing() const;
+        /**
+         * \brief Sets if external listeners receive all queued events at once in an
+         *        array instead of one call per event (only used in queued EventGroups)
+         * \param batched true if external listeners should receive arrays of events
+         */
+        void set_batched(bool batched);
+        [[nodiscard]] bool is_batched() const;
+        /**
+         * \brief Get the amount of events waiting for the next flush
+         * \return The amount of queued events
+         */
+        [[nodiscard]] virtual std::size_t get_queued_amount() const;
+        /**
+         * \brief Get the amount of listeners (C++ and external) registered to the Event
+         * \return The amount of listeners called when the Event is triggered
+         */
+        [[nodiscard]] virtual std::size_t get_listeners_amount() const;
         /**
          * \brief Registers a listener that will be called when the Event is triggered
          * \param id of the listener being added
          * \param listener Listener to register
+         * \return A handle to the listener, or to the already registered one if the id
+         *         is already used
          */
-        void add_external_listener(const std::string& id, const ExternalEventListener& listener);
+        ListenerHandle add_external_listener(
+            const std::string& id, const ExternalEventListener& listener);
         /**
          * \brief Removes a Listener from the Event
          * \param id id of the Listener to unregister
          */
         void remove_external_listener(const std::string& id);
+        /**
+         * \brief Removes a Listener from the Event
+         * \param handle Handle returned when the Listener was registered
+         */
+        void remove_external_listener(ListenerHandle handle);
     };
 
     /**
@@ -82,15 +123,24 @@ namespace obe::event
     class Event : public EventBase
     {
     private:
-        std::map<std::string, CppEventListener<EventType>> m_listeners;
-        std::vector<std::string> m_garbage_collector;
+        ListenerStorage<CppEventListener<EventType>> m_listeners;
+        // Events queued since the last flush and events being flushed, both buffers keep
+        // their capacity from one frame to another
+        std::vector<EventType> m_queue;
+        std::vector<EventType> m_flushed;
+
+        void call_listeners(const EventType& event);
 
     protected:
         /**
          * \brief Event callbacks
          */
         void trigger(const EventType& event);
-        void collect_garbage();
+        /**
+         * \brief Queues an event delivered on the next flush
+         */
+        void enqueue(EventType event);
+        void flush() override;
 
     public:
         /**
@@ -103,17 +153,33 @@ namespace obe::event
         explicit Event(
             const std::string& parent_name, const std::string& name, bool initial_state = true);
 
+        [[nodiscard]] std::size_t get_queued_amount() const override;
+        [[nodiscard]] std::size_t get_listeners_amount() const override;
         /**
          * \brief Registers a listener that will be called when the Event is triggered
          * \param id id of the Listener being added
          * \param listener Listener to register
+         * \return A handle to the listener, or to the already registered one if the id
+         *         is already used
+         */
+        ListenerHandle add_listener(
+            const std::string& id, const CppEventListener<EventType>& listener);
+        /**
+         * \brief Registers an anonymous listener, it can only be removed using its handle
+         * \param listener Listener to register
+         * \return A handle to the listener
          */
-        void add_listener(const std::string& id, const CppEventListener<EventType>& listener);
+        ListenerHandle add_listener(const CppEventListener<EventType>& listener);
         /**
          * \brief Removes a Listener from the Event
          * \param id id of the Listener to unregister
          */
         void remove_listener(const std::string& id);
+        /**
+         * \brief Removes a Listener from the Event
+         * \param handle Handle returned when the Listener was registered
+         */
+        void remove_listener(ListenerHandle handle);
 
         friend class EventGroup;
     };
@@ -121,27 +187,41 @@ namespace obe::event
     template <class EventType>
     void EventBase::trigger(const EventType& event)
     {
-        for (const auto& listener : m_listeners)
-        {
-            debug::Log->trace("<Event> Calling Event Listener '{}' from Event '{}'", listener.first,
-                m_identifier);
-            if (std::holds_alternative<LuaEventListener>(listener.second))
+        this->trigger_lua_listeners(event);
+    }
+
+    template <class EventType>
+    void EventBase::trigger_batch(const std::vector<EventType>& events)
+    {
+        // Lua listeners of batched Events receive an array with all the events
+        this->trigger_lua_listeners(sol::as_table_ref(events));
+    }
+
+    template <class PayloadType>
+    void EventBase::trigger_lua_listeners(const PayloadType& payload)
+    {
+        if (m_listeners.size() == 0)
+            return;
+        // The payload is only pushed to Lua once, all the Lua listeners receive the same value
+        LuaEventPayload<PayloadType> lua_payload(payload);
+        m_listeners.dispatch([this, &payload, &lua_payload](const std::string& listener_id,
+                                 const ExternalEventListener& listener) {
+            if (const auto* lua_listener = std::get_if<LuaEventListener>(&listener))
             {
                 this->call_listener(
-                    listener.first, std::get<LuaEventListener>(listener.second), event);
+                    listener_id,
+                    [lua_listener, &lua_payload](const PayloadType&) {
+                        lua_listener->call(lua_payload.get(lua_listener->get_lua_state()));
+                    },
+                    payload);
             }
-        }
+        });
     }
 
     template <class EventType, class ListenerType>
     void EventBase::call_listener(
         const std::string& listener_id, ListenerType&& listener, const EventType& event)
     {
-        if (std::find(m_garbage_collector.begin(), m_garbage_collector.end(), listener_id)
-            != m_garbage_collector.end())
-        {
-            return;
-        }
         try
         {
             listener(event);
@@ -152,41 +232,70 @@ namespace obe::event
         }
     }
 
+    template <class EventType>
+    void Event<EventType>::call_listeners(const EventType& event)
+    {
+        // Listeners removed while triggering are skipped, added ones wait for the next
+        // trigger
+        m_listeners.dispatch([this, &event](const std::string& listener_id,
+                                 const CppEventListener<EventType>& listener) {
+            this->call_listener(listener_id, listener, event);
+        });
+    }
+
     template <class EventType>
     void Event<EventType>::trigger(const EventType& event)
     {
         debug::Log->trace("<Event> Executing Event '{}'", m_identifier);
-        m_garbage_lock = true;
-
         if (m_enabled)
         {
             m_triggered = true;
-
-            for (const auto& listener : m_listeners)
-            {
-                debug::Log->trace("<Event> Calling Event Listener '{}' from Event '{}'",
-                    listener.first, m_identifier);
-
-                this->call_listener(listener.first, listener.second, event);
-            }
+            this->call_listeners(event);
             EventBase::trigger<EventType>(event);
-            this->collect_garbage();
-            EventBase::collect_garbage();
             m_triggered = false;
         }
+    }
 
-        m_garbage_lock = false;
+    template <class EventType>
+    void Event<EventType>::enqueue(EventType event)
+    {
+        // Event types often hold const members, the last event is replaced rather than
+        // assigned to
+        if (m_coalescing && !m_queue.empty())
+            m_queue.pop_back();
+        m_queue.push_back(std::move(event));
     }
 
     template <class EventType>
-    void Event<EventType>::collect_garbage()
+    void Event<EventType>::flush()
     {
-        debug::Log->trace("EventListeners Garbage Collection for Event {}", m_identifier);
-        for (const std::string& listener_id : m_garbage_collector)
+        if (m_queue.empty())
+            return;
+        // Events queued by listeners while flushing wait for the next flush
+        m_flushed.clear();
+        std::swap(m_queue, m_flushed);
+        debug::Log->trace(
+            "<Event> Flushing {} queued events of Event '{}'", m_flushed.size(), m_identifier);
+        if (m_enabled)
         {
-            m_listeners.erase(listener_id);
+            m_triggered = true;
+            for (const EventType& event : m_flushed)
+            {
+                this->call_listeners(event);
+                if (!m_batched)
+                    EventBase::trigger<EventType>(event);
+            }
+            if (m_batched)
+                EventBase::trigger_batch<EventType>(m_flushed);
+            m_triggered = false;
         }
-        m_garbage_collector.clear();
+        m_flushed.clear();
+    }
+
+    template <class EventType>
+    std::size_t Event<EventType>::get_queued_amount() const
+    {
+        return m_queue.size();
     }
 
     template <class EventType>
@@ -197,29 +306,41 @@ namespace obe::event
     }
 
     template <class EventType>
-    void Event<EventType>::add_listener(
+    std::size_t Event<EventType>::get_listeners_amount() const
+    {
+        return m_listeners.size() + EventBase::get_listeners_amount();
+    }
+
+    template <class EventType>
+    ListenerHandle Event<EventType>::add_listener(
         const std::string& id, const CppEventListener<EventType>& listener)
     {
         debug::Log->trace("<Event> Adding new listener '{}' to Event '{}'", id, m_identifier);
-        m_listeners.emplace(id, listener);
-        if (m_on_add_listener)
+        const std::size_t listeners_amount = m_listeners.size();
+        const ListenerHandle handle = m_listeners.add(id, listener);
+        if (m_on_add_listener && m_listeners.size() != listeners_amount)
         {
             m_on_add_listener(ListenerChangeState::Added, id);
         }
+        return handle;
+    }
+
+    template <class EventType>
+    ListenerHandle Event<EventType>::add_listener(const CppEventListener<EventType>& listener)
+    {
+        return this->add_listener("", listener);
     }
 
     template <class EventType>
     void Event<EventType>::remove_listener(const std::string& id)
     {
         debug::Log->trace("<Event> Removing listener '{}' from Event '{}'", id, m_identifier);
+        this->notify_removal(m_listeners.remove(id));
+    }
 
-        if (m_garbage_lock)
-            m_garbage_collector.push_back(id);
-        else
-            m_listeners.erase(id);
-        if (m_on_remove_listener)
-        {
-            m_on_remove_listener(ListenerChangeState::Removed, id);
-        }
+    template <class EventType>
+    void Event<EventType>::remove_listener(ListenerHandle handle)
+    {
+        this->notify_removal(m_listeners.remove(handle));
     }
 } // namespace obe::event
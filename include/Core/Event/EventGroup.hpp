@@ -84,6 +84,7 @@ namespace obe::event
         std::string m_identifier;
         std::map<std::string, std::unique_ptr<EventBase>> m_events;
         bool m_joinable = false;
+        bool m_queued = false;
 
     public:
         /**
@@ -105,6 +106,24 @@ namespace obe::event
          * \return true if the EventGroup is joinable, false otherwise
          */
         [[nodiscard]] bool is_joinable() const;
+        /**
+         * \brief Sets if the Events triggered from the EventGroup are queued and only
+         *        delivered on the next flush, pending events are flushed when disabling
+         *        the queued mode
+         * \param queued true if the EventGroup should queue its Events, false
+         *        otherwise
+         */
+        void set_queued(bool queued);
+        /**
+         * \brief Get if the EventGroup queues its Events or not
+         * \return true if the EventGroup is queued, false otherwise
+         */
+        [[nodiscard]] bool is_queued() const;
+        /**
+         * \brief Delivers the events queued since the last flush, Event by Event in the
+         *        order they were triggered
+         */
+        void flush();
         [[nodiscard]] EventBase& get(const std::string& event_name) const;
         /**
          * \brief Get a Event contained in the EventGroup
@@ -239,7 +258,11 @@ namespace obe::event
         }
         debug::Log->trace(
             "<EventGroup> Triggering Event '{}' from EventGroup '{}'", event_name, m_identifier);
-        static_cast<Event<EventType>*>(m_events.at(event_name).get())->trigger(event);
+        auto* triggered_event = static_cast<Event<EventType>*>(m_events.at(event_name).get());
+        if (m_queued)
+            triggered_event->enqueue(std::move(event));
+        else
+            triggered_event->trigger(event);
     }
 
     using EventGroupPtr = std::shared_ptr<EventGroup>;
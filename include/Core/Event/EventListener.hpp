@@ -4,6 +4,7 @@
 #include <Script/ViliLuaBridge.hpp>
 #include <functional>
 #include <string>
+#include <vector>
 
 namespace obe::event
 {
@@ -13,6 +14,28 @@ namespace obe::event
     template <class EventType>
     using CppEventListener = std::function<void(const EventType&)>;
 
+    /**
+     * \nobind
+     * \brief Lua value of an event, pushed once per trigger and shared by all the Lua
+     *        listeners of the Event
+     */
+    template <class EventType>
+    class LuaEventPayload
+    {
+    private:
+        const EventType& m_event;
+        sol::reference m_payload;
+        lua_State* m_state = nullptr;
+
+    public:
+        explicit LuaEventPayload(const EventType& event);
+        /**
+         * \brief Gets the Lua value of the event, it is only created on first use
+         * \param state Lua state of the listener about to be called
+         */
+        const sol::reference& get(lua_State* state);
+    };
+
     class LuaEventListener
     {
     private:
@@ -22,6 +45,13 @@ namespace obe::event
         LuaEventListener(sol::protected_function callback);
         template <class EventType>
         void operator()(const EventType& event) const;
+        /**
+         * \brief Calls the raw Lua function with an already pushed payload, without going
+         *        through sol's call machinery
+         * \param payload Lua value given to the listener
+         */
+        void call(const sol::reference& payload) const;
+        [[nodiscard]] lua_State* get_lua_state() const;
     };
 
     template <class EventType>
@@ -30,6 +60,23 @@ namespace obe::event
         script::safe_lua_call(m_callback, event);
     }
 
+    template <class EventType>
+    LuaEventPayload<EventType>::LuaEventPayload(const EventType& event)
+        : m_event(event)
+    {
+    }
+
+    template <class EventType>
+    const sol::reference& LuaEventPayload<EventType>::get(lua_State* state)
+    {
+        if (state != m_state)
+        {
+            m_payload = sol::make_reference(state, m_event);
+            m_state = state;
+        }
+        return m_payload;
+    }
+
     using ExternalEventListener = std::variant<LuaEventListener>;
 
     enum class ListenerChangeState
@@ -16,15 +16,29 @@ namespace obe::event
     {
     private:
         std::unordered_map<std::string, std::unique_ptr<EventNamespace>> m_namespaces;
+        // Min-heap ordered by deadline, stopped schedulers are dropped once they reach
+        // its top
         std::vector<std::unique_ptr<CallbackScheduler>> m_schedulers;
+        // Schedulers created since the last update, waiting for CallbackScheduler::run
+        std::vector<std::unique_ptr<CallbackScheduler>> m_pending_schedulers;
+        std::vector<std::unique_ptr<CallbackScheduler>> m_repeating_schedulers;
         time::Chronometer m_chrono;
 
+        static bool has_later_deadline(const std::unique_ptr<CallbackScheduler>& first,
+            const std::unique_ptr<CallbackScheduler>& second);
+        void push_scheduler(std::unique_ptr<CallbackScheduler> scheduler);
+
     public:
         explicit EventManager();
         /**
-         * \brief Updates the EventManager
+         * \brief Updates the EventManager, only the schedulers whose deadline is
+         *        reached are visited
          */
         void update();
+        /**
+         * \brief Delivers the events queued by every queued EventGroup
+         */
+        void flush() const;
         /**
          * \brief Clears the EventManager
          */
@@ -86,6 +86,10 @@ namespace obe::event
          */
         [[nodiscard]] bool is_joinable() const;
         [[nodiscard]] std::string get_name() const;
+        /**
+         * \brief Flushes every queued EventGroup of the EventNamespace
+         */
+        void flush() const;
 
         using Ptr = EventNamespace*;
     };
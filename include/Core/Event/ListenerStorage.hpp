@@ -0,0 +1,236 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace obe::event
+{
+    /**
+     * \brief Identifies a listener registered to an Event, the handle stays invalid
+     *        once the listener is removed even if its slot gets reused
+     */
+    struct ListenerHandle
+    {
+        std::size_t index = 0;
+        // Generation 0 is never given to a slot, default handles never match a listener
+        std::uint32_t generation = 0;
+
+        bool operator==(const ListenerHandle& other) const = default;
+    };
+
+    /**
+     * \nobind
+     * \brief Dense storage for the listeners of an Event
+     *
+     * Removed listeners leave a tombstone until their slot is reused by the next listener
+     * added outside of a dispatch. Listeners added during a dispatch are only called from
+     * the next one. Ids are optional and only used to look listeners up.
+     */
+    template <class Listener>
+    class ListenerStorage
+    {
+    private:
+        struct Slot
+        {
+            std::optional<Listener> listener;
+            std::string id;
+            std::uint32_t generation = 1;
+            bool alive = false;
+        };
+
+        std::vector<Slot> m_slots;
+        // Listeners added during a dispatch, appended to m_slots once it is over
+        std::vector<Slot> m_added;
+        std::vector<std::size_t> m_free_slots;
+        // Slots tombstoned during a dispatch, their listener may still be running
+        std::vector<std::size_t> m_released_slots;
+        std::unordered_map<std::string, std::size_t> m_ids;
+        std::size_t m_size = 0;
+        unsigned int m_dispatch_depth = 0;
+
+        [[nodiscard]] const Slot* get_slot(std::size_t index) const;
+        [[nodiscard]] Slot* get_slot(ListenerHandle handle);
+        void release(std::size_t index);
+        void end_dispatch();
+
+    public:
+        /**
+         * \brief Adds a listener to the storage
+         * \param id Optional id of the listener, an empty id is never looked up
+         * \param listener Listener to add
+         * \return A handle to the new listener, or to the existing one if the id is
+         *         already used
+         */
+        ListenerHandle add(const std::string& id, Listener listener);
+        /**
+         * \brief Removes a listener from the storage
+         * \param handle Handle of the listener to remove
+         * \return The id of the removed listener, nothing if the handle was invalid
+         */
+        std::optional<std::string> remove(ListenerHandle handle);
+        std::optional<std::string> remove(const std::string& id);
+        [[nodiscard]] std::optional<ListenerHandle> find(const std::string& id) const;
+        [[nodiscard]] bool contains(ListenerHandle handle) const;
+        [[nodiscard]] std::size_t size() const;
+        /**
+         * \brief Calls a function with the id and the listener of every alive slot
+         * \param callback Function called with (const std::string&, const Listener&)
+         */
+        template <class Callback>
+        void dispatch(Callback&& callback);
+    };
+
+    template <class Listener>
+    const typename ListenerStorage<Listener>::Slot* ListenerStorage<Listener>::get_slot(
+        std::size_t index) const
+    {
+        if (index < m_slots.size())
+            return &m_slots[index];
+        if (index - m_slots.size() < m_added.size())
+            return &m_added[index - m_slots.size()];
+        return nullptr;
+    }
+
+    template <class Listener>
+    typename ListenerStorage<Listener>::Slot* ListenerStorage<Listener>::get_slot(
+        ListenerHandle handle)
+    {
+        const Slot* slot = std::as_const(*this).get_slot(handle.index);
+        if (slot && slot->alive && slot->generation == handle.generation)
+            return const_cast<Slot*>(slot);
+        return nullptr;
+    }
+
+    template <class Listener>
+    void ListenerStorage<Listener>::release(std::size_t index)
+    {
+        // Only called outside of dispatches, m_added is empty by then
+        m_slots[index].listener.reset();
+        m_slots[index].id.clear();
+        m_free_slots.push_back(index);
+    }
+
+    template <class Listener>
+    void ListenerStorage<Listener>::end_dispatch()
+    {
+        if (--m_dispatch_depth > 0)
+            return;
+        for (Slot& slot : m_added)
+            m_slots.push_back(std::move(slot));
+        m_added.clear();
+        for (const std::size_t index : m_released_slots)
+            this->release(index);
+        m_released_slots.clear();
+    }
+
+    template <class Listener>
+    ListenerHandle ListenerStorage<Listener>::add(const std::string& id, Listener listener)
+    {
+        if (const std::optional<ListenerHandle> existing = this->find(id))
+            return *existing;
+        std::size_t index;
+        Slot* slot;
+        if (m_dispatch_depth == 0 && !m_free_slots.empty())
+        {
+            index = m_free_slots.back();
+            m_free_slots.pop_back();
+            slot = &m_slots[index];
+        }
+        else if (m_dispatch_depth == 0)
+        {
+            index = m_slots.size();
+            slot = &m_slots.emplace_back();
+        }
+        else
+        {
+            index = m_slots.size() + m_added.size();
+            slot = &m_added.emplace_back();
+        }
+        slot->listener.emplace(std::move(listener));
+        slot->id = id;
+        slot->alive = true;
+        if (!id.empty())
+            m_ids.emplace(id, index);
+        m_size++;
+        return ListenerHandle { index, slot->generation };
+    }
+
+    template <class Listener>
+    std::optional<std::string> ListenerStorage<Listener>::remove(ListenerHandle handle)
+    {
+        Slot* slot = this->get_slot(handle);
+        if (!slot)
+            return std::nullopt;
+        std::optional<std::string> id = slot->id;
+        if (!slot->id.empty())
+            m_ids.erase(slot->id);
+        // The listener is kept until the slot is released as it may be running right now
+        slot->alive = false;
+        if (++slot->generation == 0)
+            slot->generation = 1;
+        m_size--;
+        if (m_dispatch_depth > 0)
+            m_released_slots.push_back(handle.index);
+        else
+            this->release(handle.index);
+        return id;
+    }
+
+    template <class Listener>
+    std::optional<std::string> ListenerStorage<Listener>::remove(const std::string& id)
+    {
+        if (const std::optional<ListenerHandle> handle = this->find(id))
+            return this->remove(*handle);
+        return std::nullopt;
+    }
+
+    template <class Listener>
+    std::optional<ListenerHandle> ListenerStorage<Listener>::find(const std::string& id) const
+    {
+        const auto existing = m_ids.find(id);
+        if (existing == m_ids.end())
+            return std::nullopt;
+        return ListenerHandle { existing->second, this->get_slot(existing->second)->generation };
+    }
+
+    template <class Listener>
+    bool ListenerStorage<Listener>::contains(ListenerHandle handle) const
+    {
+        const Slot* slot = this->get_slot(handle.index);
+        return slot && slot->alive && slot->generation == handle.generation;
+    }
+
+    template <class Listener>
+    std::size_t ListenerStorage<Listener>::size() const
+    {
+        return m_size;
+    }
+
+    template <class Listener>
+    template <class Callback>
+    void ListenerStorage<Listener>::dispatch(Callback&& callback)
+    {
+        struct DispatchGuard
+        {
+            ListenerStorage& storage;
+            ~DispatchGuard()
+            {
+                storage.end_dispatch();
+            }
+        };
+        m_dispatch_depth++;
+        const DispatchGuard guard { *this };
+        // m_slots does not grow during a dispatch so references to its slots stay valid
+        const std::size_t slots_amount = m_slots.size();
+        for (std::size_t i = 0; i < slots_amount; i++)
+        {
+            const Slot& slot = m_slots[i];
+            if (slot.alive)
+                callback(slot.id, *slot.listener);
+        }
+    }
+} // namespace obe::event
@@ -40,6 +40,8 @@ namespace obe::graphics
         CoordinateTransformer m_y_transformer;
         std::string m_y_transformer_name = "Camera";
 
+        friend class SpriteCuller;
+
     public:
         /**
          * \brief Default PositionTransformer constructor
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace obe::graphics
+{
+    class Renderable;
+
+    /**
+     * \brief A persistent list of Renderables kept sorted in draw order (Higher layer /
+     *        sublayer first)
+     * \details The queue is updated incrementally when a Renderable is added, removed or
+     *          changes its layer / sublayer so drawing it never requires a full sort
+     */
+    class RenderQueue
+    {
+    private:
+        std::vector<Renderable*> m_renderables;
+        bool m_needs_sort = false;
+
+        static bool draw_order(const Renderable* renderable1, const Renderable* renderable2);
+        void insert_sorted(Renderable& renderable);
+        void erase(const Renderable& renderable);
+
+        friend class Renderable;
+
+    public:
+        RenderQueue() = default;
+        RenderQueue(const RenderQueue&) = delete;
+        RenderQueue& operator=(const RenderQueue&) = delete;
+        ~RenderQueue();
+
+        /**
+         * \brief Adds a Renderable to the queue at its draw order position
+         * \param renderable Renderable to add (it will be removed from its previous
+         *        RenderQueue if any)
+         */
+        void add(Renderable& renderable);
+        /**
+         * \brief Removes a Renderable from the queue
+         * \param renderable Renderable to remove
+         */
+        void remove(Renderable& renderable);
+        /**
+         * \brief Removes all the Renderables from the queue
+         */
+        void clear();
+        /**
+         * \brief Forces a full re-sort of the queue on the next access
+         */
+        void invalidate();
+        [[nodiscard]] bool contains(const Renderable& renderable) const;
+        [[nodiscard]] std::size_t size() const;
+        /**
+         * \brief Get all the Renderables of the queue in draw order
+         * \return A reference to the sorted Renderables
+         */
+        [[nodiscard]] const std::vector<Renderable*>& get_renderables();
+    };
+} // namespace obe::graphics
@@ -10,8 +10,19 @@ namespace obe::scene
 
 namespace obe::graphics
 {
+    class RenderQueue;
+    class SpriteBatch;
+    class SpriteCuller;
+
     class Renderable
     {
+    private:
+        RenderQueue* m_render_queue = nullptr;
+        bool m_culled = false;
+
+        friend class RenderQueue;
+        friend class SpriteCuller;
+
     protected:
         int32_t m_layer = 1;
         int32_t m_sublayer = 1;
@@ -20,7 +31,9 @@ namespace obe::graphics
     public:
         Renderable() = default;
         Renderable(int32_t layer, int32_t sublayer);
-        virtual ~Renderable() = default;
+        Renderable(const Renderable& other);
+        Renderable& operator=(const Renderable& other);
+        virtual ~Renderable();
 
         /**
          * \brief Get the layer of the Renderable
@@ -39,6 +52,12 @@ namespace obe::graphics
          * \return true if the Renderable is visible, false otherwise
          */
         [[nodiscard]] bool is_visible() const;
+        /**
+         * \brief Get whether the Renderable was found outside of the Camera during the
+         *        last culling pass
+         * \return true if the Renderable can be skipped this frame, false otherwise
+         */
+        [[nodiscard]] bool is_culled() const;
 
         /**
          * \brief Set the layer of the Renderable
@@ -62,5 +81,15 @@ namespace obe::graphics
         void hide();
 
         virtual void draw(RenderTarget& surface, const scene::Camera& camera) = 0;
+        /**
+         * \brief Draws the Renderable through a SpriteBatch
+         * \details Renderables that can't be batched flush the pending batch then draw
+         *          themselves directly (default behaviour)
+         * \param surface RenderTarget where to draw the Renderable
+         * \param camera Camera used to transform the Renderable
+         * \param batch SpriteBatch shared by the Renderables drawn in the same pass
+         */
+        virtual void draw_batched(
+            RenderTarget& surface, const scene::Camera& camera, SpriteBatch& batch);
     };
 } // namespace obe::graphics
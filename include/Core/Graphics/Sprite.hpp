@@ -13,8 +13,12 @@
 #include <Types/Selectable.hpp>
 #include <sfe/ComplexSprite.hpp>
 
+#include <optional>
+
 namespace obe::graphics
 {
+    class SpriteCuller;
+
     void make_null_texture();
 
     /**
@@ -27,6 +31,12 @@ namespace obe::graphics
                    public component::Component<Sprite>,
                    public engine::ResourceManagedObject
     {
+    private:
+        SpriteCuller* m_culler = nullptr;
+        std::size_t m_culler_index = 0;
+
+        friend class SpriteCuller;
+
     protected:
         std::string m_parentId;
         std::string m_path;
@@ -34,11 +44,17 @@ namespace obe::graphics
         Shader* m_shader = nullptr;
         sfe::ComplexSprite m_sprite;
         graphics::Texture m_texture;
+        /**
+         * \brief Size of the region used by the Sprite when its texture is packed in an atlas
+         */
+        std::optional<transform::UnitVector> m_atlas_region_size;
         bool m_antiAliasing = true;
         bool m_horizontal_flip = false;
         bool m_vertical_flip = false;
 
         void reset_unit(transform::Units unit) override;
+        std::array<sf::Vertex, 4> compute_vertices(
+            RenderTarget& surface, const scene::Camera& camera);
         void refresh_vector_texture(
             const transform::UnitVector& surface_size, const std::array<sf::Vertex, 4>& vertices);
 
@@ -52,6 +68,7 @@ namespace obe::graphics
          * \param id A std::string containing the Id of the Sprite
          */
         explicit Sprite(const std::string& id);
+        ~Sprite() override;
         /**
          * \brief Draws the handle used to scale the Sprite
          * \param surface RenderSurface where to render the handle
@@ -207,6 +224,8 @@ namespace obe::graphics
         void use_texture_size();
 
         void draw(RenderTarget& surface, const scene::Camera& camera) override;
+        void draw_batched(
+            RenderTarget& surface, const scene::Camera& camera, SpriteBatch& batch) override;
         void attach_resource_manager(engine::ResourceManager& resources) override;
         [[nodiscard]] std::string_view type() const override;
 
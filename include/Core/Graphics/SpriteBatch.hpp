@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <Graphics/RenderTarget.hpp>
+
+namespace obe::graphics
+{
+    /**
+     * \brief Counters filled by a SpriteBatch since its last reset
+     */
+    struct SpriteBatchStats
+    {
+        /**
+         * \brief Amount of quads submitted to the SpriteBatch
+         */
+        std::size_t sprites = 0;
+        /**
+         * \brief Amount of draw calls issued by the SpriteBatch
+         */
+        std::size_t draw_calls = 0;
+        /**
+         * \brief Amount of times a quad used a different texture than the previous one
+         */
+        std::size_t texture_switches = 0;
+    };
+
+    /**
+     * \brief Merges consecutive textured quads sharing the same texture, shader and blend
+     *        mode into a single draw call
+     * \details Quads are drawn in submission order, the pending batch is flushed as soon as
+     *          a quad with different render states is added
+     */
+    class SpriteBatch
+    {
+    private:
+        std::vector<sf::Vertex> m_vertices;
+        sf::RenderStates m_states;
+        const sf::Texture* m_last_texture = nullptr;
+        SpriteBatchStats m_stats;
+
+        [[nodiscard]] bool can_merge(const sf::RenderStates& states) const;
+
+    public:
+        /**
+         * \brief Queues a quad in the batch
+         * \param target RenderTarget where the pending batch is flushed if the render states
+         *        differ
+         * \param quad Vertices of the quad in triangle strip order (TopLeft, BottomLeft,
+         *        TopRight, BottomRight), already transformed
+         * \param states Texture, Shader and BlendMode used to draw the quad (transform is
+         *        ignored)
+         */
+        void add(RenderTarget& target, const std::array<sf::Vertex, 4>& quad,
+            const sf::RenderStates& states);
+        /**
+         * \brief Draws all the pending quads
+         * \param target RenderTarget where to draw the quads
+         */
+        void flush(RenderTarget& target);
+        /**
+         * \brief Amount of quads waiting to be drawn
+         */
+        [[nodiscard]] std::size_t pending() const;
+        void reset_stats();
+        [[nodiscard]] SpriteBatchStats get_stats() const;
+    };
+} // namespace obe::graphics
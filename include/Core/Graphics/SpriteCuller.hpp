@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Transform/UnitVector.hpp>
+
+namespace obe::scene
+{
+    class Camera;
+}
+
+namespace obe::graphics
+{
+    class Sprite;
+
+    /**
+     * \brief Counters filled by the last culling pass of a SpriteCuller
+     */
+    struct CullingStats
+    {
+        /**
+         * \brief Amount of Sprites handled by the SpriteCuller
+         */
+        std::size_t sprites = 0;
+        /**
+         * \brief Amount of Sprites returned by the spatial index and tested against the Camera
+         */
+        std::size_t tested = 0;
+        /**
+         * \brief Amount of Sprites that were skipped because they are outside of the Camera
+         */
+        std::size_t culled = 0;
+        /**
+         * \brief Amount of Sprites that moved and had to be reinserted in the spatial index
+         */
+        std::size_t reindexed = 0;
+    };
+
+    /**
+     * \brief Spatial index over the bounds of Sprites used to skip the ones outside of the
+     *        Camera before any vertex is computed
+     * \details Sprites are bucketed by PositionTransformer (and layer for Parallax) so each
+     *          bucket only needs a single query rectangle per frame. Sprites that can't be
+     *          located in the Scene (unknown transformer or non-Scene unit) are never culled
+     */
+    class SpriteCuller
+    {
+    private:
+        struct Bounds
+        {
+            double min_x = 0;
+            double min_y = 0;
+            double max_x = 0;
+            double max_y = 0;
+        };
+        struct CellRange
+        {
+            int32_t min_x = 0;
+            int32_t min_y = 0;
+            int32_t max_x = -1;
+            int32_t max_y = -1;
+        };
+        struct Entry
+        {
+            Sprite* sprite = nullptr;
+            std::size_t group = 0;
+            bool cullable = false;
+            bool oversized = false;
+            Bounds bounds;
+            CellRange cells;
+            uint64_t stamp = 0;
+            // Last known transform of the Sprite, used to detect changes cheaply
+            transform::UnitVector position;
+            transform::UnitVector size;
+            double angle = 0;
+            int32_t layer = 0;
+            std::string x_transformer;
+            std::string y_transformer;
+        };
+        struct Group
+        {
+            std::string x_transformer;
+            std::string y_transformer;
+            int32_t layer = 0;
+            bool cullable = false;
+            std::unordered_map<int64_t, std::vector<std::size_t>> cells;
+            std::vector<std::size_t> oversized;
+        };
+
+        std::vector<Entry> m_entries;
+        std::vector<std::size_t> m_free_entries;
+        std::vector<Group> m_groups;
+        double m_cell_size = 1.0;
+        uint64_t m_frame = 0;
+        transform::UnitVector m_pixel_scale;
+        CullingStats m_stats;
+
+        [[nodiscard]] bool has_changed(const Entry& entry) const;
+        void refresh(std::size_t index, bool force);
+        void link(std::size_t index);
+        void unlink(std::size_t index);
+        std::size_t find_group(const Entry& entry);
+        void test(std::size_t index, const Bounds& view);
+
+    public:
+        SpriteCuller() = default;
+        SpriteCuller(const SpriteCuller&) = delete;
+        SpriteCuller& operator=(const SpriteCuller&) = delete;
+        ~SpriteCuller();
+
+        /**
+         * \brief Starts tracking the bounds of a Sprite
+         * \param sprite Sprite to track
+         */
+        void add(Sprite& sprite);
+        /**
+         * \brief Stops tracking the bounds of a Sprite (Sprites do it automatically when
+         *        destroyed)
+         * \param sprite Sprite to stop tracking
+         */
+        void remove(Sprite& sprite);
+        /**
+         * \brief Stops tracking all the Sprites
+         */
+        void clear();
+        /**
+         * \brief Refreshes the bounds of the Sprites that changed then flags the ones
+         *        outside of the Camera as culled
+         * \param camera Camera used to compute the visible area
+         */
+        void update(const scene::Camera& camera);
+        /**
+         * \brief Flags all the tracked Sprites as visible
+         */
+        void uncull_all();
+        /**
+         * \brief Sets the size (in SceneUnits) of the cells of the spatial index
+         * \param cell_size Size of a cell, all the Sprites are reinserted
+         */
+        void set_cell_size(double cell_size);
+        [[nodiscard]] double get_cell_size() const;
+        [[nodiscard]] CullingStats get_stats() const;
+    };
+} // namespace obe::graphics
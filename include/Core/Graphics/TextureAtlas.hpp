@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <Graphics/Texture.hpp>
+
+namespace obe::graphics
+{
+    /**
+     * \brief Online shelf packer used to place rectangles inside a fixed-size area
+     */
+    class ShelfPacker
+    {
+    private:
+        struct Shelf
+        {
+            uint32_t y = 0;
+            uint32_t height = 0;
+            uint32_t width = 0;
+        };
+        uint32_t m_width;
+        uint32_t m_height;
+        uint32_t m_next_shelf_y = 0;
+        uint64_t m_used_area = 0;
+        std::vector<Shelf> m_shelves;
+
+    public:
+        ShelfPacker(uint32_t width, uint32_t height);
+
+        /**
+         * \brief Finds a free spot for a rectangle
+         * \param width Width of the rectangle to place
+         * \param height Height of the rectangle to place
+         * \return The top-left position of the placed rectangle or std::nullopt if there
+         *         is no room left for it
+         */
+        std::optional<sf::Vector2u> insert(uint32_t width, uint32_t height);
+        [[nodiscard]] uint32_t get_width() const;
+        [[nodiscard]] uint32_t get_height() const;
+        /**
+         * \brief Get the area (in pixels) covered by the placed rectangles
+         */
+        [[nodiscard]] uint64_t get_used_area() const;
+    };
+
+    /**
+     * \brief Occupancy report of a TextureAtlas
+     */
+    struct TextureAtlasStats
+    {
+        std::size_t pages = 0;
+        std::size_t images = 0;
+        /**
+         * \brief Amount of pixels used by the packed images (padding included)
+         */
+        uint64_t used_pixels = 0;
+        uint64_t total_pixels = 0;
+        /**
+         * \brief Ratio between used_pixels and total_pixels (0 when there is no page)
+         */
+        double occupancy = 0;
+    };
+
+    /**
+     * \brief Packs small images into shared texture pages so Sprites using them can be
+     *        batched together
+     * \details Pages are never moved nor freed while the TextureAtlas lives, so the
+     *          returned TextureParts stay valid for the lifetime of the TextureAtlas
+     */
+    class TextureAtlas
+    {
+    private:
+        struct Page
+        {
+            Texture texture;
+            ShelfPacker packer;
+        };
+        std::vector<std::unique_ptr<Page>> m_pages;
+        std::unordered_map<std::string, TexturePart> m_parts;
+        uint32_t m_page_size;
+        bool m_anti_aliasing;
+
+        Page& create_page();
+
+    public:
+        /**
+         * \brief Width of the border added around each image, the border repeats the
+         *        nearest edge pixel of the image so smoothed textures do not sample
+         *        their neighbours on the page
+         */
+        static constexpr uint32_t Padding = 1;
+
+        /**
+         * \brief Creates a new TextureAtlas
+         * \param page_size Width and height of each page (clamped to the maximum texture
+         *        size supported by the GPU)
+         * \param anti_aliasing Whether the pages are smoothed or not
+         */
+        TextureAtlas(uint32_t page_size, bool anti_aliasing);
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        /**
+         * \brief Gets an image previously packed in the atlas
+         * \param name Name the image was inserted with
+         * \return A pointer to the part of the page holding the image or nullptr
+         */
+        [[nodiscard]] const TexturePart* find(const std::string& name) const;
+        /**
+         * \brief Packs an image in the atlas (a new page is created when needed)
+         * \param name Name used to retrieve the image later
+         * \param image Pixels of the image to pack
+         * \return A pointer to the part of the page holding the image or nullptr if the
+         *         image is too big to fit in a page
+         */
+        const TexturePart* insert(const std::string& name, const sf::Image& image);
+        [[nodiscard]] uint32_t get_page_size() const;
+        [[nodiscard]] std::size_t get_page_count() const;
+        [[nodiscard]] const Texture& get_page(std::size_t index) const;
+        [[nodiscard]] TextureAtlasStats get_stats() const;
+    };
+} // namespace obe::graphics
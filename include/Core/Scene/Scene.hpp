@@ -2,10 +2,14 @@
 
 #include <Collision/ColliderComponent.hpp>
 #include <Collision/CollisionSpace.hpp>
+#include <Collision/TrajectorySystem.hpp>
 #include <Engine/ResourceManager.hpp>
 #include <Event/EventGroup.hpp>
 #include <Event/EventNamespace.hpp>
+#include <Graphics/RenderQueue.hpp>
 #include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteBatch.hpp>
+#include <Graphics/SpriteCuller.hpp>
 #include <Scene/Camera.hpp>
 #include <Scene/SceneNode.hpp>
 #include <Script/GameObject.hpp>
@@ -31,6 +35,24 @@ namespace obe::events
             static constexpr std::string_view id = "Loaded";
             std::string filename;
         };
+        struct CollisionBegin
+        {
+            static constexpr std::string_view id = "CollisionBegin";
+            const collision::Collider* collider1 = nullptr;
+            const collision::Collider* collider2 = nullptr;
+        };
+        struct CollisionStay
+        {
+            static constexpr std::string_view id = "CollisionStay";
+            const collision::Collider* collider1 = nullptr;
+            const collision::Collider* collider2 = nullptr;
+        };
+        struct CollisionEnd
+        {
+            static constexpr std::string_view id = "CollisionEnd";
+            const collision::Collider* collider1 = nullptr;
+            const collision::Collider* collider2 = nullptr;
+        };
     } // namespace Scene
 } // namespace obe::events
 
@@ -43,6 +65,8 @@ namespace obe::scene
         bool sprites = true;
         bool collisions = false;
         bool scene_nodes = false;
+        bool culling = true;
+        bool batching = true;
     };
 
     /**
@@ -65,6 +89,7 @@ namespace obe::scene
         std::unordered_set<std::string> m_sprite_ids;
 
         collision::CollisionSpace m_collision_space;
+        collision::TrajectorySystem m_trajectory_system;
         std::vector<std::unique_ptr<collision::ColliderComponent>> m_collider_array;
         std::unordered_set<std::string> m_collider_ids;
 
@@ -80,14 +105,17 @@ namespace obe::scene
         SceneRenderOptions m_render_options;
         OnSceneLoadCallback m_on_load_callback;
         event::EventGroupPtr e_scene;
+        // Contacts are only tracked while collision events have listeners
+        std::size_t m_collision_listeners = 0;
         sol::state_view m_lua;
 
         std::unordered_map<std::string, component::ComponentBase*> m_components;
 
-        bool m_sort_renderables = true;
-        std::vector<graphics::Renderable*> m_render_cache;
-        void _reorganize_layers();
+        graphics::RenderQueue m_render_queue;
+        graphics::SpriteCuller m_sprite_culler;
+        graphics::SpriteBatch m_sprite_batch;
         void _rebuild_ids();
+        void trigger_collision_events();
 
     public:
         /**
@@ -202,7 +230,9 @@ namespace obe::scene
 
         // Sprites
         /**
-         * \brief Reorganize all the Sprite (by layer and sublayer)
+         * \brief Forces a full re-sort of the Scene Renderables (by layer and sublayer)
+         * \details Renderables are kept sorted incrementally when they are created or when
+         *          their layer / sublayer changes, calling this is only needed as a fallback
          */
         void reorganize_layers();
         /**
@@ -296,6 +326,12 @@ namespace obe::scene
          */
         void remove_collider(const std::string& id);
         [[nodiscard]] collision::CollisionSpace& get_collision_space();
+        /**
+         * \brief Gets the TrajectorySystem updating the TrajectoryNodes of the Scene,
+         *        the TrajectoryNodes driving the SceneNode of a GameObject are removed
+         *        along with it
+         */
+        [[nodiscard]] collision::TrajectorySystem& get_trajectory_system();
         SceneNode& get_scene_root_node();
 
         // Other
@@ -326,6 +362,16 @@ namespace obe::scene
         const tiles::TileScene& get_tiles() const;
         SceneRenderOptions get_render_options() const;
         void set_render_options(SceneRenderOptions options);
+        /**
+         * \brief Gets the counters of the culling pass of the last drawn frame
+         * \return The amount of Sprites tested and culled during the last draw
+         */
+        [[nodiscard]] graphics::CullingStats get_culling_stats() const;
+        /**
+         * \brief Gets the counters of the SpriteBatch of the last drawn frame
+         * \return The amount of Sprites batched and draw calls issued during the last draw
+         */
+        [[nodiscard]] graphics::SpriteBatchStats get_sprite_batch_stats() const;
 
         // Components
         component::ComponentBase* get_component(const std::string& id) const;
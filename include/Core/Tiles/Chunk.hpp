@@ -0,0 +1,143 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <Collision/ComplexPolygonCollider.hpp>
+
+namespace obe::tiles
+{
+    /**
+     * \brief Rectangle of tiles (bounds are inclusive)
+     */
+    struct TileRect
+    {
+        uint32_t left = 0;
+        uint32_t top = 0;
+        uint32_t right = 0;
+        uint32_t bottom = 0;
+    };
+
+    /**
+     * \brief Gets the cells of a grid overlapped by an area
+     * \param area Area to test (in pixels)
+     * \param cell_width Width of a cell of the grid (in pixels)
+     * \param cell_height Height of a cell of the grid (in pixels)
+     * \param columns Amount of columns of the grid
+     * \param rows Amount of rows of the grid
+     * \return The overlapped cells or std::nullopt if the area is outside of the grid
+     */
+    std::optional<TileRect> get_cells_in_area(const sf::FloatRect& area, uint32_t cell_width,
+        uint32_t cell_height, uint32_t columns, uint32_t rows);
+
+    /**
+     * \brief Gets the chunks of a TileLayer holding tiles that may overlap an area
+     * \details A chunk of larger tiles covers a larger area, the returned range is the
+     *          smallest one containing the visible chunks of every tile size
+     * \param area Area to test (in pixels)
+     * \param tile_sizes Tile size of every tileset of the TileLayer (in pixels)
+     * \param chunks_width Amount of chunks in a row of the TileLayer
+     * \param chunks_height Amount of chunks in a column of the TileLayer
+     * \return The chunks to draw or std::nullopt if no chunk overlaps the area
+     */
+    std::optional<TileRect> get_chunks_in_area(const sf::FloatRect& area,
+        const std::vector<sf::Vector2u>& tile_sizes, uint32_t chunks_width,
+        uint32_t chunks_height);
+
+    /**
+     * \brief Merges the cells of a grid into as few rectangles as possible (greedy meshing)
+     * \param groups Group of each cell (row-major), only adjacent cells of the same group are
+     *        merged together and cells of group 0 are skipped
+     * \param columns Amount of columns of the grid
+     * \param rows Amount of rows of the grid
+     * \return Rectangles covering every cell of a non-zero group exactly once
+     */
+    std::vector<TileRect> merge_cells(
+        const std::vector<uint32_t>& groups, uint32_t columns, uint32_t rows);
+
+    /**
+     * \brief Checks whether a tile collider is the rectangle of the whole tile, its 4
+     *        points must be the corners of the tile in either winding
+     * \param collider Collider model of the tile, its origin is the top-left corner of the tile
+     * \param tile_width Width of the tile (in ScenePixels)
+     * \param tile_height Height of the tile (in ScenePixels)
+     */
+    bool is_whole_tile_collider(const collision::ComplexPolygonCollider& collider,
+        uint32_t tile_width, uint32_t tile_height);
+
+    /**
+     * \brief Fixed-size square of tiles of a TileLayer
+     * \details A TileChunk only allocates the quads of the tilesets its tiles actually use,
+     *          quads are never moved so they can be referenced by AnimatedTile
+     */
+    class TileChunk
+    {
+    public:
+        /**
+         * \brief Width and height of a TileChunk (in tiles)
+         */
+        static constexpr uint32_t Size = 32;
+
+        /**
+         * \brief Quads of all the tiles of a TileChunk using the same tileset
+         */
+        struct TilesetQuads
+        {
+            uint32_t first_tile_id = 0;
+            /**
+             * \brief Tiles of the TileChunk having a quad in vertices
+             */
+            std::bitset<Size * Size> tiles;
+            std::vector<sf::Vertex> vertices;
+        };
+
+    private:
+        uint32_t m_x;
+        uint32_t m_y;
+        std::vector<TilesetQuads> m_quads;
+
+        static uint32_t get_tile_index(uint32_t x, uint32_t y);
+
+    public:
+        /**
+         * \brief Creates a new empty TileChunk
+         * \param x X Coordinate of the TileChunk in the TileLayer (in chunks)
+         * \param y Y Coordinate of the TileChunk in the TileLayer (in chunks)
+         */
+        TileChunk(uint32_t x, uint32_t y);
+
+        /**
+         * \brief Gets the quad of a tile, allocating the quads of its tileset if needed
+         * \param first_tile_id First tile id of the tileset used by the tile
+         * \param x X Coordinate of the tile inside the TileChunk
+         * \param y Y Coordinate of the tile inside the TileChunk
+         * \return A pointer to the 4 vertices of the quad
+         */
+        sf::Vertex* acquire_quad(uint32_t first_tile_id, uint32_t x, uint32_t y);
+        /**
+         * \brief Clears the quad of a tile, the quads of its tileset are freed once they
+         *        are all cleared
+         */
+        void release_quad(uint32_t first_tile_id, uint32_t x, uint32_t y);
+        /**
+         * \brief Gets the quad of a tile or nullptr if its tileset has no quad in the chunk
+         */
+        [[nodiscard]] sf::Vertex* get_quad(uint32_t first_tile_id, uint32_t x, uint32_t y);
+        void clear();
+
+        [[nodiscard]] uint32_t get_x() const;
+        [[nodiscard]] uint32_t get_y() const;
+        [[nodiscard]] bool is_empty() const;
+        [[nodiscard]] const std::vector<TilesetQuads>& get_quads() const;
+        /**
+         * \brief Amount of vertices allocated by the TileChunk
+         */
+        [[nodiscard]] std::size_t get_vertex_count() const;
+    };
+} // namespace obe::tiles
@@ -2,8 +2,7 @@
 
 #include <Collision/ColliderComponent.hpp>
 #include <Graphics/Renderable.hpp>
-#include <SFML/Graphics/VertexArray.hpp>
-#include <sfe/SpannableVertexArray.hpp>
+#include <Tiles/Chunk.hpp>
 #include <string>
 #include <vector>
 
@@ -14,16 +13,20 @@ namespace obe::tiles
     class TileLayer : public graphics::Renderable
     {
     private:
-        // instead of using x + y * m_width flat index system
-        // m_positions and m_sublayers_by_tileset are using the
-        // y + x * m_height index system
-        // since layers are often more wide than high, this allows us
-        // to gain more performance by applying a span on the VertexArray
-        std::unordered_map<uint32_t, sf::Vertex*> m_positions;
-        std::unordered_map<uint32_t, sfe::SpannableVertexArray> m_sublayers_by_tileset;
+        // Quads are stored in fixed-size chunks (row-major, m_chunks_width chunks per row)
+        // which only allocate vertices for the tilesets they use
+        std::vector<TileChunk> m_chunks;
+        uint32_t m_chunks_width = 0;
+        uint32_t m_chunks_height = 0;
+        // Tile size of every tileset, used to find the chunks inside the camera
+        std::vector<sf::Vector2u> m_tile_sizes;
+        std::size_t m_drawn_vertex_count = 0;
 
         const TileScene& m_scene;
         std::unordered_map<uint32_t, collision::ColliderComponent*> m_colliders;
+        // Colliders covering several tiles (see TileScene::is_merging_colliders) with the
+        // tiles they cover, they are split back into per-tile colliders when a tile changes
+        std::unordered_map<collision::ColliderComponent*, TileRect> m_merged_colliders;
 
         std::string m_id;
         uint32_t m_x;
@@ -34,10 +37,14 @@ namespace obe::tiles
         double m_opacity = 1.0;
         std::vector<uint32_t> m_data;
 
+        TileChunk& get_chunk(uint32_t x, uint32_t y);
+        void build_chunk(TileChunk& chunk);
         void build_tile(uint32_t x, uint32_t y, uint32_t tile_id);
+        void build_tile_collider(uint32_t x, uint32_t y, uint32_t tile_id);
+        void build_merged_colliders();
+        void split_merged_collider(collision::ColliderComponent* collider);
         void clear_tile(uint32_t x, uint32_t y);
         void update_quad(sf::Vertex* quad, uint32_t tile_id) const;
-        static void clear_quad(sf::Vertex* quad);
 
     public:
         TileLayer(const TileScene& scene, const std::string& id, int32_t layer, int32_t sublayer, uint32_t x,
@@ -53,5 +60,13 @@ namespace obe::tiles
 
         void set_tile(uint32_t x, uint32_t y, uint32_t tile_id);
         uint32_t get_tile(uint32_t x, uint32_t y) const;
+        /**
+         * \brief Amount of vertices allocated by all the chunks of the TileLayer
+         */
+        [[nodiscard]] std::size_t get_vertex_count() const;
+        /**
+         * \brief Amount of vertices submitted by the last call to draw
+         */
+        [[nodiscard]] std::size_t get_drawn_vertex_count() const;
     };
 } // namespace obe::tiles
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include <vili/node.hpp>
@@ -33,6 +34,7 @@ namespace obe::tiles
         uint32_t m_tile_width;
         uint32_t m_tile_height;
         bool m_smooth = false;
+        bool m_merge_colliders = false;
 
         std::vector<std::unique_ptr<TileLayer>> m_layers;
         std::vector<std::unique_ptr<AnimatedTile>> m_animated_tiles;
@@ -40,6 +42,14 @@ namespace obe::tiles
         std::vector<vili::node> m_game_objects_models;
         TilesetCollection m_tilesets;
 
+        // Lookup tables by tile id, built once per load so building a layer is linear
+        // in its amount of tiles
+        std::unordered_map<uint32_t, AnimatedTile*> m_animated_tiles_by_id;
+        std::unordered_map<uint32_t, collision::ColliderComponent*> m_collider_models_by_id;
+        std::unordered_map<uint32_t, std::vector<const vili::node*>>
+            m_game_objects_models_by_id;
+
+        void build_indexes();
         void build();
 
     public:
@@ -60,12 +70,35 @@ namespace obe::tiles
         [[nodiscard]] std::vector<graphics::Renderable*> get_renderables() const;
         [[nodiscard]] std::vector<collision::ColliderComponent*> get_collider_models() const;
         [[nodiscard]] const std::vector<vili::node>& get_game_objects_models() const;
+        /**
+         * \brief Gets the animation of a tile
+         * \param tile_id Id of the tile (without flip flags)
+         * \return A pointer to the AnimatedTile or nullptr if the tile is not animated
+         */
+        [[nodiscard]] AnimatedTile* get_animated_tile(uint32_t tile_id) const;
+        /**
+         * \brief Gets the collider model of a tile
+         * \param tile_id Id of the tile (without flip flags)
+         * \return A pointer to the model or nullptr if the tile has no collider
+         */
+        [[nodiscard]] collision::ColliderComponent* get_collider_model(uint32_t tile_id) const;
+        /**
+         * \brief Gets the GameObject models spawned by a tile
+         * \param tile_id Id of the tile (without flip flags)
+         */
+        [[nodiscard]] const std::vector<const vili::node*>& get_tile_game_objects_models(
+            uint32_t tile_id) const;
 
         [[nodiscard]] uint32_t get_width() const;
         [[nodiscard]] uint32_t get_height() const;
         [[nodiscard]] uint32_t get_tile_width() const;
         [[nodiscard]] uint32_t get_tile_height() const;
         [[nodiscard]] bool is_anti_aliased() const;
+        /**
+         * \brief Whether adjacent full-tile rectangle colliders sharing the same tag are
+         *        merged into larger colliders when the layers are built
+         */
+        [[nodiscard]] bool is_merging_colliders() const;
 
         [[nodiscard]] scene::Scene& get_scene() const;
     };
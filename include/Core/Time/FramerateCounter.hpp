@@ -12,7 +12,7 @@ namespace obe::time
     class FramerateCounter
     {
     private:
-        TimeUnit m_last_tick = epoch();
+        TimeUnit m_last_tick = now();
         int m_framerate_counter = 0;
         int m_updates_counter = 0;
         int m_framerate_buffer = 0;
@@ -15,7 +15,8 @@ namespace obe::time
     class FramerateManager
     {
     private:
-        system::Window& m_window;
+        // Not set for headless FramerateManagers, v-sync is then only stored
+        system::Window* m_window = nullptr;
         time::TimeUnit m_clock;
         double m_delta_time = 0.0;
         double m_speed_coefficient = 1.0;
@@ -32,6 +33,11 @@ namespace obe::time
          * \brief Creates a new FramerateManager
          */
         FramerateManager(system::Window& window);
+        /**
+         * \nobind
+         * \brief Creates a new FramerateManager that is not bound to any Window
+         */
+        FramerateManager();
         /**
          * \brief Configures the FramerateManager
          * \param config Configuration of the FramerateManager
@@ -39,6 +45,8 @@ namespace obe::time
         void configure(vili::node& config);
         /**
          * \brief Updates the FramerateManager (done every time in the main loop)
+         * \details On a virtual clock every call starts a new frame, the framerate target
+         *          only applies to the monotonic clock
          */
         void update();
         /**
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace obe::time
 {
     /**
@@ -21,4 +23,43 @@ namespace obe::time
      *         Epoch
      */
     TimeUnit epoch();
+    /**
+     * \brief Get the amount of seconds elapsed on a monotonic clock, only meaningful
+     *        when compared to another value of the same clock
+     * \return A TimeUnit containing the current time of the monotonic clock
+     */
+    TimeUnit monotonic();
+    /**
+     * \brief Get the timestamp of the current frame, the frame clock is only sampled
+     *        by advance_frame so every subsystem sees the same time during a frame
+     * \return A TimeUnit containing the timestamp of the current frame
+     */
+    TimeUnit now();
+    /**
+     * \brief Get the amount of frames started since the engine started
+     * \return The index of the current frame
+     */
+    std::uint64_t get_frame_index();
+    /**
+     * \brief Get the timestamp a frame starting right now would have, on a virtual
+     *        clock it is always one step after the current frame
+     * \return A TimeUnit containing the timestamp of the next frame
+     */
+    TimeUnit get_next_frame_time();
+    /**
+     * \brief Samples the frame clock for a new frame (done by the FramerateManager every
+     *        time a frame is due)
+     */
+    void advance_frame();
+    /**
+     * \brief Makes the frame clock virtual, every frame then lasts exactly `step` seconds
+     *        regardless of the time it actually took (for replays and benchmarks)
+     * \param step Duration of a frame in seconds, 0 to go back to the monotonic clock
+     */
+    void set_virtual_clock(TimeUnit step);
+    /**
+     * \brief Get if the frame clock is virtual or not
+     * \return true if the frame clock advances by a fixed step, false otherwise
+     */
+    bool is_clock_virtual();
 } // namespace obe::time
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace obe::utils
+{
+    /**
+     * \brief Fixed set of worker threads running submitted jobs in FIFO order
+     * \details Jobs that did not start yet are dropped when the ThreadPool is destroyed,
+     *          their futures then report a std::future_error (broken_promise)
+     */
+    class ThreadPool
+    {
+    private:
+        std::vector<std::thread> m_workers;
+        std::deque<std::function<void()>> m_jobs;
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        bool m_stopping = false;
+
+        void work();
+
+    public:
+        /**
+         * \brief Creates a new ThreadPool
+         * \param workers Amount of worker threads (at least one worker is created)
+         */
+        explicit ThreadPool(std::size_t workers = default_worker_count());
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        ~ThreadPool();
+
+        /**
+         * \brief Amount of workers used when none is given : one less than the amount of
+         *        hardware threads so the main thread keeps a core for itself
+         */
+        static std::size_t default_worker_count();
+
+        /**
+         * \brief Queues a job to be run by one of the workers
+         * \param job Callable taking no argument
+         * \return A future holding the result (or exception) of the job
+         */
+        template <class Callable>
+        std::future<std::invoke_result_t<Callable>> submit(Callable&& job);
+        [[nodiscard]] std::size_t get_worker_count() const;
+    };
+
+    template <class Callable>
+    std::future<std::invoke_result_t<Callable>> ThreadPool::submit(Callable&& job)
+    {
+        using Result = std::invoke_result_t<Callable>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Callable>(job));
+        std::future<Result> result = task->get_future();
+        {
+            std::lock_guard lock(m_mutex);
+            m_jobs.emplace_back([task]() { (*task)(); });
+        }
+        m_condition.notify_one();
+        return result;
+    }
+} // namespace obe::utils
@@ -196,8 +196,7 @@ namespace obe::animation
         {
             for (auto& image : source.at("images"))
             {
-                const graphics::Texture& texture = this->load_texture(image);
-                m_frames.push_back(texture.make_texture_part());
+                m_frames.push_back(this->load_texture_part(image));
             }
         }
         else if (source.contains("spritesheet"))
@@ -274,6 +273,21 @@ namespace obe::animation
         }
     }
 
+    graphics::TexturePart Animation::load_texture_part(const std::string& local_path)
+    {
+        if (m_resource_manager)
+        {
+            debug::Log->trace(
+                "    <animation> Loading TexturePart {0} (using ResourceManager)", local_path);
+            const graphics::TexturePart texture_part
+                = m_resource_manager->get_texture_part(m_path.add(local_path), m_anti_aliasing);
+            // Keeps the texture (or atlas page) alive when the ResourceManager gets cleaned
+            m_textures.emplace_back(texture_part.get_texture());
+            return texture_part;
+        }
+        return this->load_texture(local_path).make_texture_part();
+    }
+
     const graphics::Texture& Animation::load_texture(const std::string& local_path)
     {
         std::string texture_name = local_path;
@@ -320,9 +334,9 @@ namespace obe::animation
         {
             const time::TimeUnit delay = (m_sleep) ? m_sleep : m_parent.m_delay;
             debug::Log->trace("<animation> Delay is {} seconds", delay);
-            if (time::epoch() - m_clock > delay)
+            if (time::now() - m_clock > delay)
             {
-                m_clock = time::epoch();
+                m_clock = time::now();
                 m_sleep = 0;
                 debug::Log->trace("<animation> Updating animation '{0}'", m_parent.m_name);
 
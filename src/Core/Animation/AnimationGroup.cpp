@@ -7,9 +7,9 @@ namespace obe::animation
 {
     bool AnimationGroup::is_delay_elapsed()
     {
-        if (time::epoch() - m_group_clock > m_delay)
+        if (time::now() - m_group_clock > m_delay)
         {
-            m_group_clock = time::epoch();
+            m_group_clock = time::now();
             return true;
         }
         return false;
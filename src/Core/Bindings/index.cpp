@@ -164,11 +164,15 @@ namespace obe::bindings
         obe::collision::bindings::load_class_complex_polygon_collider(state);
         obe::collision::bindings::load_class_polygon_collider(state);
         obe::collision::bindings::load_class_quadtree(state);
+        obe::collision::bindings::load_class_quadtree_stats(state);
+        obe::collision::bindings::load_class_spatial_hash_grid(state);
         obe::collision::bindings::load_class_rectangle_collider(state);
         obe::collision::bindings::load_class_trajectory(state);
         obe::collision::bindings::load_class_trajectory_node(state);
+        obe::collision::bindings::load_class_trajectory_system(state);
         obe::collision::bindings::load_class_collision_rejection_pair(state);
         obe::collision::bindings::load_enum_collider_type(state);
+        obe::collision::bindings::load_enum_broadphase_type(state);
         obe::collision::bindings::load_function_collider_type_to_c2type(state);
         obe::component::bindings::load_class_component_base(state);
         obe::config::bindings::load_class_configuration_manager(state);
@@ -183,10 +187,12 @@ namespace obe::bindings
         obe::event::bindings::load_class_event_manager(state);
         obe::event::bindings::load_class_event_namespace(state);
         obe::event::bindings::load_class_event_namespace_view(state);
+        obe::event::bindings::load_class_listener_handle(state);
         obe::event::bindings::load_class_lua_event_listener(state);
         obe::event::bindings::load_enum_callback_scheduler_state(state);
         obe::event::bindings::load_enum_listener_change_state(state);
         obe::graphics::bindings::load_class_color(state);
+        obe::graphics::bindings::load_class_culling_stats(state);
         obe::graphics::bindings::load_class_editor_sprite(state);
         obe::graphics::bindings::load_class_font(state);
         obe::graphics::bindings::load_class_nine_patch(state);
@@ -196,12 +202,14 @@ namespace obe::bindings
         obe::graphics::bindings::load_class_rich_text(state);
         obe::graphics::bindings::load_class_shader(state);
         obe::graphics::bindings::load_class_sprite(state);
+        obe::graphics::bindings::load_class_sprite_batch_stats(state);
         obe::graphics::bindings::load_class_sprite_handle_point(state);
         obe::graphics::bindings::load_class_spritesheet(state);
         obe::graphics::bindings::load_class_svg_texture(state);
         obe::graphics::bindings::load_class_text(state);
         obe::graphics::bindings::load_class_texture(state);
         obe::graphics::bindings::load_class_texture_part(state);
+        obe::graphics::bindings::load_class_texture_atlas_stats(state);
         obe::graphics::bindings::load_class_hsv(state);
         obe::graphics::bindings::load_enum_color_type(state);
         obe::graphics::bindings::load_enum_sprite_handle_point_type(state);
@@ -294,6 +302,13 @@ namespace obe::bindings
         obe::time::bindings::load_class_framerate_counter(state);
         obe::time::bindings::load_class_framerate_manager(state);
         obe::time::bindings::load_function_epoch(state);
+        obe::time::bindings::load_function_monotonic(state);
+        obe::time::bindings::load_function_now(state);
+        obe::time::bindings::load_function_get_frame_index(state);
+        obe::time::bindings::load_function_get_next_frame_time(state);
+        obe::time::bindings::load_function_advance_frame(state);
+        obe::time::bindings::load_function_set_virtual_clock(state);
+        obe::time::bindings::load_function_is_clock_virtual(state);
         obe::time::bindings::load_global_seconds(state);
         obe::time::bindings::load_global_milliseconds(state);
         obe::time::bindings::load_global_microseconds(state);
@@ -368,6 +383,9 @@ namespace obe::bindings
         obe::events::Network::bindings::load_class_connected(state);
         obe::events::Network::bindings::load_class_disconnected(state);
         obe::events::Network::bindings::load_class_message(state);
+        obe::events::Scene::bindings::load_class_collision_begin(state);
+        obe::events::Scene::bindings::load_class_collision_end(state);
+        obe::events::Scene::bindings::load_class_collision_stay(state);
         obe::events::Scene::bindings::load_class_loaded(state);
         obe::graphics::utils::bindings::load_class_draw_polygon_options(state);
         obe::graphics::utils::bindings::load_function_draw_point(state);
@@ -9,8 +9,10 @@
 #include <Collision/PolygonCollider.hpp>
 #include <Collision/Quadtree.hpp>
 #include <Collision/RectangleCollider.hpp>
+#include <Collision/SpatialHashGrid.hpp>
 #include <Collision/Trajectory.hpp>
 #include <Collision/TrajectoryNode.hpp>
+#include <Collision/TrajectorySystem.hpp>
 
 #include <Bindings/Config.hpp>
 
@@ -27,6 +29,13 @@ namespace obe::collision::bindings
                 { "Polygon", obe::collision::ColliderType::Polygon },
                 { "ComplexPolygon", obe::collision::ColliderType::ComplexPolygon } });
     }
+    void load_enum_broadphase_type(sol::state_view state)
+    {
+        sol::table collision_namespace = state["obe"]["collision"].get<sol::table>();
+        collision_namespace.new_enum<obe::collision::BroadphaseType>("BroadphaseType",
+            { { "Quadtree", obe::collision::BroadphaseType::Quadtree },
+                { "SpatialHashGrid", obe::collision::BroadphaseType::SpatialHashGrid } });
+    }
     void load_class_capsule_collider(sol::state_view state)
     {
         sol::table collision_namespace = state["obe"]["collision"].get<sol::table>();
@@ -161,6 +170,7 @@ namespace obe::collision::bindings
             = &obe::collision::CollisionSpace::refresh_collider;
         bind_collision_space["refresh_quadtree"]
             = &obe::collision::CollisionSpace::refresh_quadtree;
+        bind_collision_space["update"] = &obe::collision::CollisionSpace::update;
         bind_collision_space["collides"] = &obe::collision::CollisionSpace::collides;
         bind_collision_space["get_offset_before_collision"] = sol::overload(
             [](obe::collision::CollisionSpace* self,
@@ -197,6 +207,25 @@ namespace obe::collision::bindings
             = &obe::collision::CollisionSpace::remove_tag_to_blacklist;
         bind_collision_space["clear_blacklist"] = &obe::collision::CollisionSpace::clear_blacklist;
         bind_collision_space["get_blacklist"] = &obe::collision::CollisionSpace::get_blacklist;
+        bind_collision_space["set_narrowphase_workers"]
+            = &obe::collision::CollisionSpace::set_narrowphase_workers;
+        bind_collision_space["get_narrowphase_workers"]
+            = &obe::collision::CollisionSpace::get_narrowphase_workers;
+        bind_collision_space["set_quadtree_limits"]
+            = &obe::collision::CollisionSpace::set_quadtree_limits;
+        bind_collision_space["set_broadphase"] = &obe::collision::CollisionSpace::set_broadphase;
+        bind_collision_space["get_broadphase"] = &obe::collision::CollisionSpace::get_broadphase;
+        bind_collision_space["set_grid_cell_size"]
+            = &obe::collision::CollisionSpace::set_grid_cell_size;
+        bind_collision_space["get_grid_cell_size"]
+            = &obe::collision::CollisionSpace::get_grid_cell_size;
+        bind_collision_space["get_bounds"] = &obe::collision::CollisionSpace::get_bounds;
+        bind_collision_space["get_quadtree_stats"]
+            = &obe::collision::CollisionSpace::get_quadtree_stats;
+        bind_collision_space["get_quadtree_threshold"]
+            = &obe::collision::CollisionSpace::get_quadtree_threshold;
+        bind_collision_space["get_quadtree_max_depth"]
+            = &obe::collision::CollisionSpace::get_quadtree_max_depth;
     }
     void load_class_complex_polygon_collider(sol::state_view state)
     {
@@ -223,6 +252,10 @@ namespace obe::collision::bindings
                 int point_index) -> void { return self->add_point(position, point_index); });
         bind_complex_polygon_collider["get_points_amount"]
             = &obe::collision::ComplexPolygonCollider::get_points_amount;
+        bind_complex_polygon_collider["get_points"]
+            = &obe::collision::ComplexPolygonCollider::get_points;
+        bind_complex_polygon_collider["get_pieces_amount"]
+            = &obe::collision::ComplexPolygonCollider::get_pieces_amount;
         bind_complex_polygon_collider["collides"]
             = &obe::collision::ComplexPolygonCollider::collides;
         bind_complex_polygon_collider["get_offset_before_collision"] = sol::overload(
@@ -285,8 +318,54 @@ namespace obe::collision::bindings
         bind_quadtree["clear"] = &obe::collision::Quadtree::clear;
         bind_quadtree["add"] = &obe::collision::Quadtree::add;
         bind_quadtree["remove"] = &obe::collision::Quadtree::remove;
-        bind_quadtree["query"] = &obe::collision::Quadtree::query;
-        bind_quadtree["find_all_intersections"] = &obe::collision::Quadtree::find_all_intersections;
+        bind_quadtree["reset"] = &obe::collision::Quadtree::reset;
+        bind_quadtree["get_box"] = &obe::collision::Quadtree::get_box;
+        bind_quadtree["get_threshold"] = &obe::collision::Quadtree::get_threshold;
+        bind_quadtree["get_max_depth"] = &obe::collision::Quadtree::get_max_depth;
+        bind_quadtree["query"]
+            = static_cast<std::vector<const obe::collision::Collider*> (obe::collision::Quadtree::*)(
+                const obe::transform::AABB&) const>(&obe::collision::Quadtree::query);
+        bind_quadtree["find_all_intersections"]
+            = static_cast<std::vector<std::pair<const obe::collision::Collider*,
+                const obe::collision::Collider*>> (obe::collision::Quadtree::*)() const>(
+                &obe::collision::Quadtree::find_all_intersections);
+        bind_quadtree["get_stats"] = &obe::collision::Quadtree::get_stats;
+    }
+    void load_class_quadtree_stats(sol::state_view state)
+    {
+        sol::table collision_namespace = state["obe"]["collision"].get<sol::table>();
+        sol::usertype<obe::collision::QuadtreeStats> bind_quadtree_stats
+            = collision_namespace.new_usertype<obe::collision::QuadtreeStats>(
+                "QuadtreeStats", sol::call_constructor, sol::default_constructor);
+        bind_quadtree_stats["nodes"] = &obe::collision::QuadtreeStats::nodes;
+        bind_quadtree_stats["leaves"] = &obe::collision::QuadtreeStats::leaves;
+        bind_quadtree_stats["depth"] = &obe::collision::QuadtreeStats::depth;
+        bind_quadtree_stats["values"] = &obe::collision::QuadtreeStats::values;
+        bind_quadtree_stats["interior_values"] = &obe::collision::QuadtreeStats::interior_values;
+        bind_quadtree_stats["max_leaf_values"] = &obe::collision::QuadtreeStats::max_leaf_values;
+        bind_quadtree_stats["average_leaf_values"]
+            = &obe::collision::QuadtreeStats::average_leaf_values;
+    }
+    void load_class_spatial_hash_grid(sol::state_view state)
+    {
+        sol::table collision_namespace = state["obe"]["collision"].get<sol::table>();
+        sol::usertype<obe::collision::SpatialHashGrid> bind_spatial_hash_grid
+            = collision_namespace.new_usertype<obe::collision::SpatialHashGrid>("SpatialHashGrid",
+                sol::call_constructor,
+                sol::constructors<obe::collision::SpatialHashGrid(),
+                    obe::collision::SpatialHashGrid(double)>());
+        bind_spatial_hash_grid["clear"] = &obe::collision::SpatialHashGrid::clear;
+        bind_spatial_hash_grid["get_cell_size"] = &obe::collision::SpatialHashGrid::get_cell_size;
+        bind_spatial_hash_grid["add"] = &obe::collision::SpatialHashGrid::add;
+        bind_spatial_hash_grid["remove"] = &obe::collision::SpatialHashGrid::remove;
+        bind_spatial_hash_grid["query"]
+            = static_cast<std::vector<const obe::collision::Collider*> (
+                obe::collision::SpatialHashGrid::*)(const obe::transform::AABB&) const>(
+                &obe::collision::SpatialHashGrid::query);
+        bind_spatial_hash_grid["find_all_intersections"]
+            = static_cast<std::vector<std::pair<const obe::collision::Collider*,
+                const obe::collision::Collider*>> (obe::collision::SpatialHashGrid::*)() const>(
+                &obe::collision::SpatialHashGrid::find_all_intersections);
     }
     void load_class_rectangle_collider(sol::state_view state)
     {
@@ -329,6 +408,7 @@ namespace obe::collision::bindings
         bind_trajectory["get_on_collide_callback"]
             = &obe::collision::Trajectory::get_on_collide_callback;
         bind_trajectory["get_speed"] = &obe::collision::Trajectory::get_speed;
+        bind_trajectory["get_substep_length"] = &obe::collision::Trajectory::get_substep_length;
         bind_trajectory["is_static"] = &obe::collision::Trajectory::is_static;
         bind_trajectory["get_unit"] = &obe::collision::Trajectory::get_unit;
         bind_trajectory["on_collide"] = &obe::collision::Trajectory::on_collide;
@@ -337,6 +417,7 @@ namespace obe::collision::bindings
         bind_trajectory["set_angle"] = &obe::collision::Trajectory::set_angle;
         bind_trajectory["set_speed"] = &obe::collision::Trajectory::set_speed;
         bind_trajectory["set_static"] = &obe::collision::Trajectory::set_static;
+        bind_trajectory["set_substep_length"] = &obe::collision::Trajectory::set_substep_length;
         bind_trajectory["get_reachable_collider_acceptor"]
             = &obe::collision::Trajectory::get_reachable_collider_acceptor;
         bind_trajectory["set_reachable_collider_acceptor"]
@@ -348,7 +429,9 @@ namespace obe::collision::bindings
         sol::usertype<obe::collision::TrajectoryNode> bind_trajectory_node
             = collision_namespace.new_usertype<obe::collision::TrajectoryNode>("TrajectoryNode",
                 sol::call_constructor,
-                sol::constructors<obe::collision::TrajectoryNode(obe::scene::SceneNode&)>());
+                sol::constructors<obe::collision::TrajectoryNode(obe::scene::SceneNode&),
+                    obe::collision::TrajectoryNode(
+                        obe::scene::SceneNode&, obe::collision::TrajectorySystem&)>());
         bind_trajectory_node["add_trajectory"]
             = sol::overload([](obe::collision::TrajectoryNode* self, const std::string& id)
                                 -> obe::collision::Trajectory& { return self->add_trajectory(id); },
@@ -361,7 +444,27 @@ namespace obe::collision::bindings
         bind_trajectory_node["remove_trajectory"]
             = &obe::collision::TrajectoryNode::remove_trajectory;
         bind_trajectory_node["set_probe"] = &obe::collision::TrajectoryNode::set_probe;
-        bind_trajectory_node["update"] = &obe::collision::TrajectoryNode::update;
+        bind_trajectory_node["get_system"] = &obe::collision::TrajectoryNode::get_system;
+        bind_trajectory_node["update"]
+            = static_cast<void (obe::collision::TrajectoryNode::*)(double) const>(
+                &obe::collision::TrajectoryNode::update);
+    }
+    void load_class_trajectory_system(sol::state_view state)
+    {
+        sol::table collision_namespace = state["obe"]["collision"].get<sol::table>();
+        sol::usertype<obe::collision::TrajectorySystem> bind_trajectory_system
+            = collision_namespace.new_usertype<obe::collision::TrajectorySystem>(
+                "TrajectorySystem", sol::call_constructor,
+                sol::constructors<obe::collision::TrajectorySystem()>(), sol::base_classes,
+                sol::bases<obe::types::Togglable>());
+        bind_trajectory_system["add"] = &obe::collision::TrajectorySystem::add;
+        bind_trajectory_system["remove"] = &obe::collision::TrajectorySystem::remove;
+        bind_trajectory_system["remove_nodes"] = &obe::collision::TrajectorySystem::remove_nodes;
+        bind_trajectory_system["clear"] = &obe::collision::TrajectorySystem::clear;
+        bind_trajectory_system["contains"] = &obe::collision::TrajectorySystem::contains;
+        bind_trajectory_system["get_nodes_amount"]
+            = &obe::collision::TrajectorySystem::get_nodes_amount;
+        bind_trajectory_system["update"] = &obe::collision::TrajectorySystem::update;
     }
     void load_class_collision_rejection_pair(sol::state_view state)
     {
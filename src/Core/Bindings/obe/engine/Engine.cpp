@@ -52,8 +52,45 @@ namespace obe::engine::bindings
                 static_cast<const obe::graphics::Texture& (
                     obe::engine::ResourceManager::*)(const obe::system::Path&)>(
                     &obe::engine::ResourceManager::get_texture));
+        bind_resource_manager["get_texture_part"]
+            = sol::overload(static_cast<obe::graphics::TexturePart (
+                                obe::engine::ResourceManager::*)(const obe::system::Path&, bool)>(
+                                &obe::engine::ResourceManager::get_texture_part),
+                static_cast<obe::graphics::TexturePart (
+                    obe::engine::ResourceManager::*)(const obe::system::Path&)>(
+                    &obe::engine::ResourceManager::get_texture_part));
+        bind_resource_manager["get_atlas_stats"] = &obe::engine::ResourceManager::get_atlas_stats;
+        bind_resource_manager["load_texture_async"] = sol::overload(
+            static_cast<const obe::graphics::Texture& (obe::engine::ResourceManager::*)(
+                const obe::system::Path&, bool, const obe::engine::TextureLoadedCallback&)>(
+                &obe::engine::ResourceManager::load_texture_async),
+            static_cast<const obe::graphics::Texture& (obe::engine::ResourceManager::*)(
+                const obe::system::Path&, const obe::engine::TextureLoadedCallback&)>(
+                &obe::engine::ResourceManager::load_texture_async),
+            [](obe::engine::ResourceManager* self, const obe::system::Path& path,
+                bool anti_aliasing) -> const obe::graphics::Texture& {
+                return self->load_texture_async(path, anti_aliasing);
+            },
+            [](obe::engine::ResourceManager* self, const obe::system::Path& path)
+                -> const obe::graphics::Texture& { return self->load_texture_async(path); });
+        bind_resource_manager["load_font_async"] = sol::overload(
+            &obe::engine::ResourceManager::load_font_async,
+            [](obe::engine::ResourceManager* self, const std::string& path)
+                -> std::shared_ptr<obe::graphics::Font> { return self->load_font_async(path); });
+        bind_resource_manager["update"] = &obe::engine::ResourceManager::update;
+        bind_resource_manager["get_pending_loads"]
+            = &obe::engine::ResourceManager::get_pending_loads;
         bind_resource_manager["clean"] = &obe::engine::ResourceManager::clean;
         bind_resource_manager["default_anti_aliasing"]
             = &obe::engine::ResourceManager::default_anti_aliasing;
+        bind_resource_manager["use_texture_atlas"]
+            = &obe::engine::ResourceManager::use_texture_atlas;
+        bind_resource_manager["atlas_page_size"] = &obe::engine::ResourceManager::atlas_page_size;
+        bind_resource_manager["atlas_max_image_size"]
+            = &obe::engine::ResourceManager::atlas_max_image_size;
+        bind_resource_manager["async_uploads_per_update"]
+            = &obe::engine::ResourceManager::async_uploads_per_update;
+        bind_resource_manager["placeholder_color"]
+            = &obe::engine::ResourceManager::placeholder_color;
     }
 };
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <Event/EventListener.hpp>
 #include <Event/EventManager.hpp>
 #include <Event/EventNamespace.hpp>
+#include <Event/ListenerStorage.hpp>
 #include <Event/LuaEvent.hpp>
 
 #include <Bindings/Config.hpp>
@@ -50,9 +51,18 @@ namespace obe::event::bindings
         bind_event_base["get_state"] = &obe::event::EventBase::get_state;
         bind_event_base["get_name"] = &obe::event::EventBase::get_name;
         bind_event_base["get_identifier"] = &obe::event::EventBase::get_identifier;
+        bind_event_base["set_coalescing"] = &obe::event::EventBase::set_coalescing;
+        bind_event_base["is_coalescing"] = &obe::event::EventBase::is_coalescing;
+        bind_event_base["set_batched"] = &obe::event::EventBase::set_batched;
+        bind_event_base["is_batched"] = &obe::event::EventBase::is_batched;
+        bind_event_base["get_queued_amount"] = &obe::event::EventBase::get_queued_amount;
+        bind_event_base["get_listeners_amount"] = &obe::event::EventBase::get_listeners_amount;
         bind_event_base["add_external_listener"] = &obe::event::EventBase::add_external_listener;
-        bind_event_base["remove_external_listener"]
-            = &obe::event::EventBase::remove_external_listener;
+        bind_event_base["remove_external_listener"] = sol::overload(
+            static_cast<void (obe::event::EventBase::*)(const std::string&)>(
+                &obe::event::EventBase::remove_external_listener),
+            static_cast<void (obe::event::EventBase::*)(obe::event::ListenerHandle)>(
+                &obe::event::EventBase::remove_external_listener));
     }
     void load_class_event_group(sol::state_view state)
     {
@@ -63,6 +73,9 @@ namespace obe::event::bindings
         bind_event_group["get_view"] = &obe::event::EventGroup::get_view;
         bind_event_group["set_joinable"] = &obe::event::EventGroup::set_joinable;
         bind_event_group["is_joinable"] = &obe::event::EventGroup::is_joinable;
+        bind_event_group["set_queued"] = &obe::event::EventGroup::set_queued;
+        bind_event_group["is_queued"] = &obe::event::EventGroup::is_queued;
+        bind_event_group["flush"] = &obe::event::EventGroup::flush;
         bind_event_group["get"] = static_cast<obe::event::EventBase& (
             obe::event::EventGroup::*)(const std::string&) const>(&obe::event::EventGroup::get);
         bind_event_group["contains"] = &obe::event::EventGroup::contains;
@@ -106,6 +119,7 @@ namespace obe::event::bindings
             = event_namespace.new_usertype<obe::event::EventManager>("EventManager",
                 sol::call_constructor, sol::constructors<obe::event::EventManager()>());
         bind_event_manager["update"] = &obe::event::EventManager::update;
+        bind_event_manager["flush"] = &obe::event::EventManager::flush;
         bind_event_manager["clear"] = &obe::event::EventManager::clear;
         bind_event_manager["create_namespace"] = &obe::event::EventManager::create_namespace;
         bind_event_manager["join_namespace"] = &obe::event::EventManager::join_namespace;
@@ -132,6 +146,7 @@ namespace obe::event::bindings
         bind_event_namespace["set_joinable"] = &obe::event::EventNamespace::set_joinable;
         bind_event_namespace["is_joinable"] = &obe::event::EventNamespace::is_joinable;
         bind_event_namespace["get_name"] = &obe::event::EventNamespace::get_name;
+        bind_event_namespace["flush"] = &obe::event::EventNamespace::flush;
     }
     void load_class_event_namespace_view(sol::state_view state)
     {
@@ -149,6 +164,15 @@ namespace obe::event::bindings
             = &obe::event::EventNamespaceView::does_group_exists;
         bind_event_namespace_view["get_name"] = &obe::event::EventNamespaceView::get_name;
     }
+    void load_class_listener_handle(sol::state_view state)
+    {
+        sol::table event_namespace = state["obe"]["event"].get<sol::table>();
+        sol::usertype<obe::event::ListenerHandle> bind_listener_handle
+            = event_namespace.new_usertype<obe::event::ListenerHandle>(
+                "ListenerHandle", sol::call_constructor, sol::default_constructor);
+        bind_listener_handle["index"] = &obe::event::ListenerHandle::index;
+        bind_listener_handle["generation"] = &obe::event::ListenerHandle::generation;
+    }
     void load_class_lua_event_listener(sol::state_view state)
     {
         sol::table event_namespace = state["obe"]["event"].get<sol::table>();
@@ -6,6 +6,36 @@
 
 namespace obe::events::Scene::bindings
 {
+    void load_class_collision_begin(sol::state_view state)
+    {
+        sol::table Scene_namespace = state["obe"]["events"]["Scene"].get<sol::table>();
+        sol::usertype<obe::events::Scene::CollisionBegin> bind_collision_begin
+            = Scene_namespace.new_usertype<obe::events::Scene::CollisionBegin>(
+                "CollisionBegin", sol::call_constructor, sol::default_constructor);
+        bind_collision_begin["collider1"] = &obe::events::Scene::CollisionBegin::collider1;
+        bind_collision_begin["collider2"] = &obe::events::Scene::CollisionBegin::collider2;
+        bind_collision_begin["id"] = sol::var(&obe::events::Scene::CollisionBegin::id);
+    }
+    void load_class_collision_end(sol::state_view state)
+    {
+        sol::table Scene_namespace = state["obe"]["events"]["Scene"].get<sol::table>();
+        sol::usertype<obe::events::Scene::CollisionEnd> bind_collision_end
+            = Scene_namespace.new_usertype<obe::events::Scene::CollisionEnd>(
+                "CollisionEnd", sol::call_constructor, sol::default_constructor);
+        bind_collision_end["collider1"] = &obe::events::Scene::CollisionEnd::collider1;
+        bind_collision_end["collider2"] = &obe::events::Scene::CollisionEnd::collider2;
+        bind_collision_end["id"] = sol::var(&obe::events::Scene::CollisionEnd::id);
+    }
+    void load_class_collision_stay(sol::state_view state)
+    {
+        sol::table Scene_namespace = state["obe"]["events"]["Scene"].get<sol::table>();
+        sol::usertype<obe::events::Scene::CollisionStay> bind_collision_stay
+            = Scene_namespace.new_usertype<obe::events::Scene::CollisionStay>(
+                "CollisionStay", sol::call_constructor, sol::default_constructor);
+        bind_collision_stay["collider1"] = &obe::events::Scene::CollisionStay::collider1;
+        bind_collision_stay["collider2"] = &obe::events::Scene::CollisionStay::collider2;
+        bind_collision_stay["id"] = sol::var(&obe::events::Scene::CollisionStay::id);
+    }
     void load_class_loaded(sol::state_view state)
     {
         sol::table Scene_namespace = state["obe"]["events"]["Scene"].get<sol::table>();
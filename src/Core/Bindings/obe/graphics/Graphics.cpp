@@ -8,9 +8,12 @@
 #include <Graphics/Renderable.hpp>
 #include <Graphics/Shader.hpp>
 #include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteBatch.hpp>
+#include <Graphics/SpriteCuller.hpp>
 #include <Graphics/Spritesheet.hpp>
 #include <Graphics/Text.hpp>
 #include <Graphics/Texture.hpp>
+#include <Graphics/TextureAtlas.hpp>
 
 #include <Bindings/Config.hpp>
 
@@ -235,6 +238,17 @@ namespace obe::graphics::bindings
         bind_color["Yellow"] = sol::var(&obe::graphics::Color::Yellow);
         bind_color["YellowGreen"] = sol::var(&obe::graphics::Color::YellowGreen);
     }
+    void load_class_culling_stats(sol::state_view state)
+    {
+        sol::table graphics_namespace = state["obe"]["graphics"].get<sol::table>();
+        sol::usertype<obe::graphics::CullingStats> bind_culling_stats
+            = graphics_namespace.new_usertype<obe::graphics::CullingStats>(
+                "CullingStats", sol::call_constructor, sol::default_constructor);
+        bind_culling_stats["sprites"] = &obe::graphics::CullingStats::sprites;
+        bind_culling_stats["tested"] = &obe::graphics::CullingStats::tested;
+        bind_culling_stats["culled"] = &obe::graphics::CullingStats::culled;
+        bind_culling_stats["reindexed"] = &obe::graphics::CullingStats::reindexed;
+    }
     void load_class_editor_sprite(sol::state_view state)
     {
         sol::table graphics_namespace = state["obe"]["graphics"].get<sol::table>();
@@ -351,6 +365,7 @@ namespace obe::graphics::bindings
         bind_renderable["get_layer"] = &obe::graphics::Renderable::get_layer;
         bind_renderable["get_sublayer"] = &obe::graphics::Renderable::get_sublayer;
         bind_renderable["is_visible"] = &obe::graphics::Renderable::is_visible;
+        bind_renderable["is_culled"] = &obe::graphics::Renderable::is_culled;
         bind_renderable["set_layer"] = &obe::graphics::Renderable::set_layer;
         bind_renderable["set_sublayer"] = &obe::graphics::Renderable::set_sublayer;
         bind_renderable["set_visible"] = &obe::graphics::Renderable::set_visible;
@@ -447,6 +462,17 @@ namespace obe::graphics::bindings
 
         obe::graphics::Sprite::Register();
     }
+    void load_class_sprite_batch_stats(sol::state_view state)
+    {
+        sol::table graphics_namespace = state["obe"]["graphics"].get<sol::table>();
+        sol::usertype<obe::graphics::SpriteBatchStats> bind_sprite_batch_stats
+            = graphics_namespace.new_usertype<obe::graphics::SpriteBatchStats>(
+                "SpriteBatchStats", sol::call_constructor, sol::default_constructor);
+        bind_sprite_batch_stats["sprites"] = &obe::graphics::SpriteBatchStats::sprites;
+        bind_sprite_batch_stats["draw_calls"] = &obe::graphics::SpriteBatchStats::draw_calls;
+        bind_sprite_batch_stats["texture_switches"]
+            = &obe::graphics::SpriteBatchStats::texture_switches;
+    }
     void load_class_sprite_handle_point(sol::state_view state)
     {
         sol::table graphics_namespace = state["obe"]["graphics"].get<sol::table>();
@@ -552,6 +578,18 @@ namespace obe::graphics::bindings
         bind_texture_part["get_texture_rect"] = &obe::graphics::TexturePart::get_texture_rect;
         bind_texture_part["get_size"] = &obe::graphics::TexturePart::get_size;
     }
+    void load_class_texture_atlas_stats(sol::state_view state)
+    {
+        sol::table graphics_namespace = state["obe"]["graphics"].get<sol::table>();
+        sol::usertype<obe::graphics::TextureAtlasStats> bind_texture_atlas_stats
+            = graphics_namespace.new_usertype<obe::graphics::TextureAtlasStats>(
+                "TextureAtlasStats", sol::call_constructor, sol::default_constructor);
+        bind_texture_atlas_stats["pages"] = &obe::graphics::TextureAtlasStats::pages;
+        bind_texture_atlas_stats["images"] = &obe::graphics::TextureAtlasStats::images;
+        bind_texture_atlas_stats["used_pixels"] = &obe::graphics::TextureAtlasStats::used_pixels;
+        bind_texture_atlas_stats["total_pixels"] = &obe::graphics::TextureAtlasStats::total_pixels;
+        bind_texture_atlas_stats["occupancy"] = &obe::graphics::TextureAtlasStats::occupancy;
+    }
     void load_class_hsv(sol::state_view state)
     {
         sol::table graphics_namespace = state["obe"]["graphics"].get<sol::table>();
@@ -110,6 +110,7 @@ namespace obe::scene::bindings
         bind_scene["does_collider_exists"] = &obe::scene::Scene::does_collider_exists;
         bind_scene["remove_collider"] = &obe::scene::Scene::remove_collider;
         bind_scene["get_collision_space"] = &obe::scene::Scene::get_collision_space;
+        bind_scene["get_trajectory_system"] = &obe::scene::Scene::get_trajectory_system;
         bind_scene["get_scene_root_node"] = &obe::scene::Scene::get_scene_root_node;
         bind_scene["get_filesystem_path"] = &obe::scene::Scene::get_filesystem_path;
         bind_scene["reload"]
@@ -124,6 +125,8 @@ namespace obe::scene::bindings
         };
         bind_scene["get_render_options"] = &obe::scene::Scene::get_render_options;
         bind_scene["set_render_options"] = &obe::scene::Scene::set_render_options;
+        bind_scene["get_culling_stats"] = &obe::scene::Scene::get_culling_stats;
+        bind_scene["get_sprite_batch_stats"] = &obe::scene::Scene::get_sprite_batch_stats;
         bind_scene["get_component"] = &obe::scene::Scene::get_component;
     }
     void load_class_scene_node(sol::state_view state)
@@ -150,5 +153,7 @@ namespace obe::scene::bindings
         bind_scene_render_options["sprites"] = &obe::scene::SceneRenderOptions::sprites;
         bind_scene_render_options["collisions"] = &obe::scene::SceneRenderOptions::collisions;
         bind_scene_render_options["scene_nodes"] = &obe::scene::SceneRenderOptions::scene_nodes;
+        bind_scene_render_options["culling"] = &obe::scene::SceneRenderOptions::culling;
+        bind_scene_render_options["batching"] = &obe::scene::SceneRenderOptions::batching;
     }
 };
\ No newline at end of file
@@ -45,6 +45,9 @@ namespace obe::tiles::bindings
         bind_tile_layer["draw"] = &obe::tiles::TileLayer::draw;
         bind_tile_layer["set_tile"] = &obe::tiles::TileLayer::set_tile;
         bind_tile_layer["get_tile"] = &obe::tiles::TileLayer::get_tile;
+        bind_tile_layer["get_vertex_count"] = &obe::tiles::TileLayer::get_vertex_count;
+        bind_tile_layer["get_drawn_vertex_count"]
+            = &obe::tiles::TileLayer::get_drawn_vertex_count;
     }
     void load_class_tile_scene(sol::state_view state)
     {
@@ -71,11 +74,14 @@ namespace obe::tiles::bindings
         bind_tile_scene["get_collider_models"] = &obe::tiles::TileScene::get_collider_models;
         bind_tile_scene["get_game_objects_models"]
             = &obe::tiles::TileScene::get_game_objects_models;
+        bind_tile_scene["get_animated_tile"] = &obe::tiles::TileScene::get_animated_tile;
+        bind_tile_scene["get_collider_model"] = &obe::tiles::TileScene::get_collider_model;
         bind_tile_scene["get_width"] = &obe::tiles::TileScene::get_width;
         bind_tile_scene["get_height"] = &obe::tiles::TileScene::get_height;
         bind_tile_scene["get_tile_width"] = &obe::tiles::TileScene::get_tile_width;
         bind_tile_scene["get_tile_height"] = &obe::tiles::TileScene::get_tile_height;
         bind_tile_scene["is_anti_aliased"] = &obe::tiles::TileScene::is_anti_aliased;
+        bind_tile_scene["is_merging_colliders"] = &obe::tiles::TileScene::is_merging_colliders;
         bind_tile_scene["get_scene"] = &obe::tiles::TileScene::get_scene;
     }
     void load_class_tileset(sol::state_view state)
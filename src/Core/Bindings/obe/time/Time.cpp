@@ -71,6 +71,41 @@ namespace obe::time::bindings
         sol::table time_namespace = state["obe"]["time"].get<sol::table>();
         time_namespace.set_function("epoch", &obe::time::epoch);
     }
+    void load_function_monotonic(sol::state_view state)
+    {
+        sol::table time_namespace = state["obe"]["time"].get<sol::table>();
+        time_namespace.set_function("monotonic", &obe::time::monotonic);
+    }
+    void load_function_now(sol::state_view state)
+    {
+        sol::table time_namespace = state["obe"]["time"].get<sol::table>();
+        time_namespace.set_function("now", &obe::time::now);
+    }
+    void load_function_get_frame_index(sol::state_view state)
+    {
+        sol::table time_namespace = state["obe"]["time"].get<sol::table>();
+        time_namespace.set_function("get_frame_index", &obe::time::get_frame_index);
+    }
+    void load_function_get_next_frame_time(sol::state_view state)
+    {
+        sol::table time_namespace = state["obe"]["time"].get<sol::table>();
+        time_namespace.set_function("get_next_frame_time", &obe::time::get_next_frame_time);
+    }
+    void load_function_advance_frame(sol::state_view state)
+    {
+        sol::table time_namespace = state["obe"]["time"].get<sol::table>();
+        time_namespace.set_function("advance_frame", &obe::time::advance_frame);
+    }
+    void load_function_set_virtual_clock(sol::state_view state)
+    {
+        sol::table time_namespace = state["obe"]["time"].get<sol::table>();
+        time_namespace.set_function("set_virtual_clock", &obe::time::set_virtual_clock);
+    }
+    void load_function_is_clock_virtual(sol::state_view state)
+    {
+        sol::table time_namespace = state["obe"]["time"].get<sol::table>();
+        time_namespace.set_function("is_clock_virtual", &obe::time::is_clock_virtual);
+    }
     void load_global_seconds(sol::state_view state)
     {
         sol::table time_namespace = state["obe"]["time"].get<sol::table>();
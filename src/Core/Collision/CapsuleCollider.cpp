@@ -40,11 +40,13 @@ namespace obe::collision
     void CapsuleCollider::set_position(const transform::UnitVector& position)
     {
         Collider::set_position(position);
+        this->invalidate_bounding_box();
     }
 
     void CapsuleCollider::move(const transform::UnitVector& position)
     {
         Collider::move(position);
+        this->invalidate_bounding_box();
     }
 
     float CapsuleCollider::get_radius() const
@@ -55,5 +57,6 @@ namespace obe::collision
     void CapsuleCollider::set_radius(float radius)
     {
         m_shape.r = radius;
+        this->invalidate_bounding_box();
     }
 }
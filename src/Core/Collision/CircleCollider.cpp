@@ -45,12 +45,14 @@ namespace obe::collision
     {
         Movable::set_position(position);
         update_shape();
+        this->invalidate_bounding_box();
     }
 
     void CircleCollider::move(const transform::UnitVector& position)
     {
         Movable::move(position);
         update_shape();
+        this->invalidate_bounding_box();
     }
 
     float CircleCollider::get_radius() const
@@ -61,5 +63,6 @@ namespace obe::collision
     void CircleCollider::set_radius(const float radius)
     {
         m_shape.r = radius;
+        this->invalidate_bounding_box();
     }
 }
@@ -1,16 +1,82 @@
 #define CUTE_C2_IMPLEMENTATION
 
+#include <algorithm>
+
 #include <cute/cute_c2.h>
 
 #include <Collision/CapsuleCollider.hpp>
 #include <Collision/CircleCollider.hpp>
 #include <Collision/Collider.hpp>
+#include <Collision/CollisionSpace.hpp>
+#include <Collision/ComplexPolygonCollider.hpp>
 #include <Collision/Exceptions.hpp>
 #include <Collision/PolygonCollider.hpp>
 #include <Collision/RectangleCollider.hpp>
 
 namespace obe::collision
 {
+    // Distance under which two shapes are considered touching
+    constexpr float CONTACT_DISTANCE = 1e-4f;
+    // Distance touching shapes are moved back to know if they move into each other
+    constexpr float CONTACT_BACKOFF = 1e-2f;
+    constexpr int MAX_ADVANCEMENT_STEPS = 32;
+
+    namespace
+    {
+        c2x translated(const c2x* transform, c2v offset)
+        {
+            c2x result = transform ? *transform : c2xIdentity();
+            result.p = c2Add(result.p, offset);
+            return result;
+        }
+
+        /**
+         * \brief Finds when a shape moving by an offset first touches another one, by
+         *        conservative advancement
+         * \param leaving_contact Set to true if the shapes are already touching and
+         *        the move does not go into the other shape
+         * \return The fraction of the offset travelled before touching, 1 if the
+         *         shapes never touch
+         */
+        float time_of_impact(const void* a_shape, C2_TYPE a_type, const c2x* a_transform,
+            const void* b_shape, C2_TYPE b_type, const c2x* b_transform, c2v offset,
+            bool& leaving_contact)
+        {
+            float toi = 0;
+            for (int step = 0; step < MAX_ADVANCEMENT_STEPS; step++)
+            {
+                const c2x a_moved = translated(a_transform, c2Mulvs(offset, toi));
+                c2v a_closest;
+                c2v b_closest;
+                const float distance = c2GJK(a_shape, a_type, &a_moved, b_shape, b_type,
+                    b_transform, &a_closest, &b_closest, 1, nullptr, nullptr);
+                if (distance < CONTACT_DISTANCE && toi > 0)
+                    return toi;
+                if (distance < CONTACT_DISTANCE)
+                {
+                    const c2x a_backed_off = translated(
+                        a_transform, c2Mulvs(offset, -CONTACT_BACKOFF / c2Len(offset)));
+                    const float backed_off_distance = c2GJK(a_shape, a_type, &a_backed_off,
+                        b_shape, b_type, b_transform, &a_closest, &b_closest, 1, nullptr, nullptr);
+                    if (backed_off_distance > CONTACT_DISTANCE
+                        && c2Dot(offset, c2Sub(b_closest, a_closest)) > 0)
+                        return 0;
+                    leaving_contact = true;
+                    return 1;
+                }
+                // Nothing gets closer faster than the offset along the closest points
+                const float approach_speed
+                    = c2Dot(offset, c2Sub(b_closest, a_closest)) / distance;
+                if (approach_speed <= 0)
+                    return 1;
+                toi += distance / approach_speed;
+                if (toi > 1)
+                    return 1;
+            }
+            return toi;
+        }
+    }
+
     C2_TYPE collider_type_to_c2type(ColliderType collider_type)
     {
         switch (collider_type)
@@ -25,6 +91,9 @@ namespace obe::collision
             return C2_TYPE_CAPSULE;
         case ColliderType::Polygon:
             return C2_TYPE_POLY;
+        // Complex polygons are made of convex polygon pieces
+        case ColliderType::ComplexPolygon:
+            return C2_TYPE_POLY;
         }
         return C2_TYPE_NONE;
     }
@@ -34,53 +103,123 @@ namespace obe::collision
         return Collider::Type;
     }
 
+    std::span<const c2Poly> Collider::get_c2_pieces() const
+    {
+        return {};
+    }
+
+    template <class Callback>
+    bool Collider::for_each_c2_shape(Callback&& callback) const
+    {
+        if (const void* shape = this->get_c2_shape())
+        {
+            return callback(shape, collider_type_to_c2type(this->get_collider_type()));
+        }
+        for (const c2Poly& piece : this->get_c2_pieces())
+        {
+            if (!callback(static_cast<const void*>(&piece), C2_TYPE_POLY))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void Collider::invalidate_bounding_box()
+    {
+        if (m_collision_space)
+        {
+            m_collision_space->invalidate_collider(this);
+        }
+    }
+
     Collider::Collider(const transform::UnitVector& position)
         : Movable(position)
     {
     }
 
+    Collider::Collider(const Collider& other)
+        : Movable(other)
+        , m_tag(other.m_tag)
+    {
+    }
+
+    Collider& Collider::operator=(const Collider& other)
+    {
+        Movable::operator=(other);
+        m_tag = other.m_tag;
+        this->invalidate_bounding_box();
+        return *this;
+    }
+
+    Collider::~Collider()
+    {
+        if (m_collision_space)
+        {
+            m_collision_space->remove_collider(this);
+        }
+    }
+
     void Collider::set_tag(const std::string& tag)
     {
-        m_tag = tag;
+        m_tag = ColliderTags::get_id(tag);
     }
 
     std::string Collider::get_tag() const
+    {
+        return ColliderTags::get_name(m_tag);
+    }
+
+    ColliderTagId Collider::get_tag_id() const
     {
         return m_tag;
     }
 
     bool Collider::collides(const Collider& collider) const
     {
-        const void* a_c2_shape = this->get_c2_shape();
-        const void* b_c2_shape = collider.get_c2_shape();
-        const C2_TYPE a_type = collider_type_to_c2type(this->get_collider_type());
-        const C2_TYPE b_type = collider_type_to_c2type(collider.get_collider_type());
         const c2x* a_transform = this->get_c2_space_transform();
         const c2x* b_transform = collider.get_c2_space_transform();
-        return c2Collided(a_c2_shape, a_transform, a_type, b_c2_shape, b_transform, b_type);
+        bool collides = false;
+        this->for_each_c2_shape([&](const void* a_c2_shape, C2_TYPE a_type) {
+            return collider.for_each_c2_shape([&](const void* b_c2_shape, C2_TYPE b_type) {
+                collides
+                    = c2Collided(a_c2_shape, a_transform, a_type, b_c2_shape, b_transform, b_type);
+                return !collides;
+            });
+        });
+        return collides;
     }
 
     transform::UnitVector Collider::get_offset_before_collision(const Collider& collider,
         const transform::UnitVector& self_offset, const transform::UnitVector& other_offset) const
     {
-        const void* a_c2_shape = this->get_c2_shape();
-        const void* b_c2_shape = collider.get_c2_shape();
-        const C2_TYPE a_type = collider_type_to_c2type(this->get_collider_type());
-        const C2_TYPE b_type = collider_type_to_c2type(collider.get_collider_type());
         const c2v c2_self_offset
             = { static_cast<float>(self_offset.x), static_cast<float>(self_offset.y) };
         const c2v c2_other_offset
             = { static_cast<float>(other_offset.x), static_cast<float>(other_offset.y) };
         const c2x* a_transform = this->get_c2_space_transform();
         const c2x* b_transform = collider.get_c2_space_transform();
-        const c2TOIResult result = c2TOI(a_c2_shape, a_type, a_transform, c2_self_offset,
-            b_c2_shape, b_type, b_transform, c2_other_offset, 0);
-        const auto final_offset = self_offset * result.toi;
-        if (final_offset.x == 0 && final_offset.y == 0)
+        const c2v relative_offset = c2Sub(c2_self_offset, c2_other_offset);
+        // Earliest time of impact between any two shapes or pieces of the Colliders
+        float toi = 1;
+        bool leaving_contact = false;
+        if (relative_offset.x != 0 || relative_offset.y != 0)
+        {
+            this->for_each_c2_shape([&](const void* a_c2_shape, C2_TYPE a_type) {
+                return collider.for_each_c2_shape([&](const void* b_c2_shape, C2_TYPE b_type) {
+                    toi = std::min(toi,
+                        time_of_impact(a_c2_shape, a_type, a_transform, b_c2_shape, b_type,
+                            b_transform, relative_offset, leaving_contact));
+                    return toi > 0;
+                });
+            });
+        }
+        if (toi == 0)
         {
-            return self_offset;
+            return transform::UnitVector(0, 0, self_offset.unit);
         }
-        if (final_offset == self_offset && this->collides(collider))
+        const auto final_offset = self_offset * toi;
+        if (final_offset == self_offset && !leaving_contact && this->collides(collider))
         {
             return transform::UnitVector(0, 0);
         }
@@ -103,6 +242,9 @@ namespace obe::collision
             return std::make_unique<CapsuleCollider>(static_cast<const CapsuleCollider&>(*this));
         case ColliderType::Polygon:
             return std::make_unique<PolygonCollider>(static_cast<const PolygonCollider&>(*this));
+        case ColliderType::ComplexPolygon:
+            return std::make_unique<ComplexPolygonCollider>(
+                static_cast<const ComplexPolygonCollider&>(*this));
         default:
             throw exceptions::InvalidColliderType("?");
         }
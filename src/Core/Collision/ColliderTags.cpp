@@ -0,0 +1,37 @@
+#include <Collision/ColliderTags.hpp>
+
+namespace obe::collision
+{
+    ColliderTags::ColliderTags()
+    {
+        m_names.emplace_back();
+        m_ids.emplace(std::string(), 0);
+    }
+
+    ColliderTags& ColliderTags::instance()
+    {
+        static ColliderTags tags;
+        return tags;
+    }
+
+    ColliderTagId ColliderTags::get_id(const std::string& name)
+    {
+        ColliderTags& tags = instance();
+        std::lock_guard lock(tags.m_mutex);
+        const auto [tag, inserted]
+            = tags.m_ids.emplace(name, static_cast<ColliderTagId>(tags.m_names.size()));
+        if (inserted)
+        {
+            tags.m_names.push_back(name);
+        }
+        return tag->second;
+    }
+
+    const std::string& ColliderTags::get_name(ColliderTagId id)
+    {
+        ColliderTags& tags = instance();
+        std::lock_guard lock(tags.m_mutex);
+        // Elements of a std::deque never move when pushing at the back
+        return tags.m_names.at(id);
+    }
+}
@@ -1,4 +1,7 @@
+#include <algorithm>
+
 #include <Collision/CollisionSpace.hpp>
+#include <Collision/Exceptions.hpp>
 #include <Time/TimeUtils.hpp>
 
 namespace obe::collision
@@ -19,40 +22,257 @@ namespace obe::collision
     bool CollisionSpace::can_collide_with(
         const Collider& collider1, const Collider& collider2, bool check_both_directions) const
     {
-        const std::string tag = collider1.get_tag();
-        if (m_tags_blacklists.contains(tag))
+        const ColliderTagId tag1 = collider1.get_tag_id();
+        const ColliderTagId tag2 = collider2.get_tag_id();
+        return !is_tag_rejected(tag1, tag2)
+            && (!check_both_directions || !is_tag_rejected(tag2, tag1));
+    }
+
+    bool CollisionSpace::is_tag_rejected(ColliderTagId source_tag, ColliderTagId rejected_tag) const
+    {
+        if (source_tag >= m_blacklist_masks.size())
+        {
+            return false;
+        }
+        const std::vector<std::uint64_t>& mask = m_blacklist_masks[source_tag];
+        const std::size_t word = rejected_tag / 64;
+        return word < mask.size() && (mask[word] >> (rejected_tag % 64)) & 1;
+    }
+
+    void CollisionSpace::set_tag_rejected(
+        ColliderTagId source_tag, ColliderTagId rejected_tag, bool rejected)
+    {
+        if (source_tag >= m_blacklist_masks.size())
+        {
+            m_blacklist_masks.resize(source_tag + 1);
+        }
+        std::vector<std::uint64_t>& mask = m_blacklist_masks[source_tag];
+        const std::size_t word = rejected_tag / 64;
+        if (word >= mask.size())
+        {
+            mask.resize(word + 1, 0);
+        }
+        const std::uint64_t bit = std::uint64_t(1) << (rejected_tag % 64);
+        if (rejected)
+            mask[word] |= bit;
+        else
+            mask[word] &= ~bit;
+    }
+
+    // Smallest side of the area covered by the Quadtree
+    constexpr double MIN_WORLD_SIZE = 1;
+    // The Quadtree covers this many times the extent of the Colliders so they can
+    // move around before it has to grow
+    constexpr double WORLD_MARGIN_RATIO = 2;
+    constexpr std::size_t REBUILD_DIRTY_RATIO = 4;
+    // Smaller batches are not worth waking the narrowphase workers
+    constexpr std::size_t MIN_PARALLEL_BATCH = 64;
+
+    namespace
+    {
+        /**
+         * \brief Computes a square area centered on the given extent, leaving room
+         *        around it for the Colliders to move
+         */
+        transform::AABB fit_world_box(double min_x, double min_y, double max_x, double max_y)
+        {
+            const double side = std::max(
+                WORLD_MARGIN_RATIO * std::max(max_x - min_x, max_y - min_y), MIN_WORLD_SIZE);
+            return transform::AABB(transform::UnitVector((min_x + max_x - side) / 2,
+                                       (min_y + max_y - side) / 2),
+                transform::UnitVector(side, side));
+        }
+
+        /**
+         * \brief Calls job(begin, end) on contiguous slices of [0, size), one slice per
+         *        worker plus one for the calling thread
+         */
+        template <class Job>
+        void for_each_slice(utils::ThreadPool* pool, std::size_t size, const Job& job)
         {
-            const auto& tag_blacklist = m_tags_blacklists.at(tag);
-            if (tag_blacklist.contains(collider2.get_tag()))
+            if (pool == nullptr || size < MIN_PARALLEL_BATCH)
+            {
+                job(std::size_t(0), size);
+                return;
+            }
+            const std::size_t slices = pool->get_worker_count() + 1;
+            const std::size_t slice_size = (size + slices - 1) / slices;
+            std::vector<std::future<void>> workers;
+            workers.reserve(slices - 1);
+            for (std::size_t begin = slice_size; begin < size; begin += slice_size)
+            {
+                const std::size_t end = std::min(size, begin + slice_size);
+                workers.push_back(pool->submit([&job, begin, end]() { job(begin, end); }));
+            }
+            std::exception_ptr error;
+            try
+            {
+                job(std::size_t(0), std::min(size, slice_size));
+            }
+            catch (...)
             {
-                return false;
+                error = std::current_exception();
+            }
+            // Every slice must be done before job goes out of scope
+            for (std::future<void>& worker : workers)
+            {
+                try
+                {
+                    worker.get();
+                }
+                catch (...)
+                {
+                    if (!error)
+                        error = std::current_exception();
+                }
+            }
+            if (error)
+            {
+                std::rethrow_exception(error);
             }
         }
+    }
 
-        const bool is_valid
-            = (!check_both_directions || can_collide_with(collider2, collider1, false));
+    CollisionSpace::CollisionSpace()
+        : m_broadphase(std::in_place_type<Quadtree>, fit_world_box(0, 0, 0, 0))
+    {
+    }
 
-            
-        // if true, check if we need to check for tags on collider2 -> collider1
-        return is_valid;
+    CollisionSpace::~CollisionSpace()
+    {
+        for (const auto& [collider, box] : m_colliders)
+        {
+            collider->m_collision_space = nullptr;
+            collider->m_dirty = false;
+        }
+    }
+
+    void CollisionSpace::invalidate_collider(const Collider* collider)
+    {
+        if (!collider->m_dirty)
+        {
+            collider->m_dirty = true;
+            m_dirty_colliders.push_back(collider);
+        }
     }
 
-    constexpr double COLLISION_SPACE_SIZE = 100000000;
+    bool CollisionSpace::reinsert_collider(const Collider* collider) const
+    {
+        const transform::AABB box = collider->get_bounding_box();
+        if (!this->broadphase_covers(box))
+        {
+            return false;
+        }
+        transform::AABB& inserted_box = m_colliders.at(collider);
+        std::visit(
+            [collider, &inserted_box, &box](auto& broadphase) {
+                broadphase.remove(collider, inserted_box);
+                inserted_box = box;
+                broadphase.add(collider, inserted_box);
+            },
+            m_broadphase);
+        collider->m_dirty = false;
+        return true;
+    }
 
-    CollisionSpace::CollisionSpace()
-        : m_quadtree(
-            transform::AABB(
-                transform::UnitVector(-COLLISION_SPACE_SIZE, -COLLISION_SPACE_SIZE),
-                transform::UnitVector(2 * COLLISION_SPACE_SIZE, 2 * COLLISION_SPACE_SIZE)
-            )
-        )
+    void CollisionSpace::rebuild_broadphase() const
     {
+        double min_x = 0, min_y = 0, max_x = 0, max_y = 0;
+        bool first = true;
+        for (auto& [collider, box] : m_colliders)
+        {
+            box = collider->get_bounding_box();
+            const transform::UnitVector top_left
+                = box.get_position(transform::Referential::TopLeft);
+            const transform::UnitVector bottom_right
+                = box.get_position(transform::Referential::BottomRight);
+            min_x = first ? top_left.x : std::min(min_x, top_left.x);
+            min_y = first ? top_left.y : std::min(min_y, top_left.y);
+            max_x = first ? bottom_right.x : std::max(max_x, bottom_right.x);
+            max_y = first ? bottom_right.y : std::max(max_y, bottom_right.y);
+            first = false;
+        }
+        if (auto* quadtree = std::get_if<Quadtree>(&m_broadphase))
+        {
+            quadtree->reset(fit_world_box(min_x, min_y, max_x, max_y));
+        }
+        else
+        {
+            std::get<SpatialHashGrid>(m_broadphase).clear();
+        }
+        std::visit(
+            [this](auto& broadphase) {
+                for (const auto& [collider, box] : m_colliders)
+                {
+                    broadphase.add(collider, box);
+                    collider->m_dirty = false;
+                }
+            },
+            m_broadphase);
+        m_dirty_colliders.clear();
+    }
+
+    bool CollisionSpace::broadphase_covers(const transform::AABB& box) const
+    {
+        const auto* quadtree = std::get_if<Quadtree>(&m_broadphase);
+        return !quadtree || quadtree->get_box().contains(box);
+    }
+
+    template <class Visitor>
+    void CollisionSpace::visit_broadphase(const transform::AABB& box, Visitor&& visitor) const
+    {
+        std::visit([&box, &visitor](const auto& broadphase) { broadphase.visit(box, visitor); },
+            m_broadphase);
+    }
+
+    void CollisionSpace::update_dirty_colliders() const
+    {
+        if (m_dirty_colliders.empty())
+        {
+            return;
+        }
+        // Past this point, removing each moved Collider costs more than a rebuild
+        if (m_dirty_colliders.size() * REBUILD_DIRTY_RATIO >= m_colliders.size())
+        {
+            this->rebuild_broadphase();
+            return;
+        }
+        for (const Collider* collider : m_dirty_colliders)
+        {
+            // Colliders refreshed manually in the meantime are already up to date
+            // A Collider leaving the Quadtree makes it grow, which rebuilds all of them
+            if (collider->m_dirty && !this->reinsert_collider(collider))
+            {
+                this->rebuild_broadphase();
+                return;
+            }
+        }
+        m_dirty_colliders.clear();
     }
 
     void CollisionSpace::add_collider(const Collider* collider)
     {
-        m_colliders.insert(collider);
-        m_quadtree.add(collider);
+        if (collider->m_collision_space == this)
+        {
+            return;
+        }
+        if (collider->m_collision_space)
+        {
+            collider->m_collision_space->remove_collider(collider);
+        }
+        const transform::AABB box = collider->get_bounding_box();
+        m_colliders.emplace(collider, box);
+        collider->m_collision_space = this;
+        if (this->broadphase_covers(box))
+        {
+            std::visit(
+                [collider, &box](auto& broadphase) { broadphase.add(collider, box); },
+                m_broadphase);
+        }
+        else
+        {
+            this->rebuild_broadphase();
+        }
     }
 
     std::size_t CollisionSpace::get_collider_amount() const
@@ -62,51 +282,84 @@ namespace obe::collision
 
     std::unordered_set<const Collider*> CollisionSpace::get_all_colliders() const
     {
-        return m_colliders;
+        std::unordered_set<const Collider*> colliders;
+        colliders.reserve(m_colliders.size());
+        for (const auto& [collider, box] : m_colliders)
+        {
+            colliders.insert(collider);
+        }
+        return colliders;
     }
 
     void CollisionSpace::remove_collider(const Collider* collider)
     {
-        m_colliders.erase(collider);
-        m_quadtree.remove(collider);
+        const auto collider_it = m_colliders.find(collider);
+        if (collider_it == m_colliders.end())
+        {
+            return;
+        }
+        if (collider->m_dirty)
+        {
+            std::erase(m_dirty_colliders, collider);
+            collider->m_dirty = false;
+        }
+        std::visit(
+            [collider, &box = collider_it->second](
+                auto& broadphase) { broadphase.remove(collider, box); },
+            m_broadphase);
+        m_colliders.erase(collider_it);
+        std::erase_if(m_contacts, [collider](const CollisionPair& contact) {
+            return contact.first == collider || contact.second == collider;
+        });
+        collider->m_collision_space = nullptr;
     }
 
     void CollisionSpace::refresh_collider(const Collider* collider)
     {
-        m_quadtree.remove(collider);
-        m_quadtree.add(collider);
+        if (m_colliders.contains(collider) && !this->reinsert_collider(collider))
+        {
+            this->rebuild_broadphase();
+        }
     }
 
     void CollisionSpace::refresh_quadtree()
     {
-        m_quadtree.clear();
-        for (const Collider* collider : m_colliders)
-        {
-            m_quadtree.add(collider);
-        }
+        this->rebuild_broadphase();
     }
 
-    bool CollisionSpace::collides(const Collider& collider) const
+    void CollisionSpace::update()
     {
-        std::vector<const Collider*> possible_collisions
-            = m_quadtree.query(collider.get_bounding_box());
+        this->update_dirty_colliders();
+    }
 
-        for (const Collider* space_collider : possible_collisions)
-        {
-            if (&collider != space_collider && can_collide_with(collider, *space_collider)
-                && collider.collides(*space_collider))
-            {
-                return true;
-            }
-        }
-        return false;
+    bool CollisionSpace::collides(const Collider& collider) const
+    {
+        this->update_dirty_colliders();
+        bool collides = false;
+        this->visit_broadphase(collider.get_bounding_box(),
+            [this, &collider, &collides](const Collider* space_collider) {
+                collides = &collider != space_collider
+                    && can_collide_with(collider, *space_collider)
+                    && collider.collides(*space_collider);
+                return !collides;
+            });
+        return collides;
     }
 
     transform::UnitVector CollisionSpace::get_offset_before_collision(const Collider& collider,
         const transform::UnitVector& offset) const
     {
-        const std::vector<ReachableCollider> reachable_colliders = this->get_reachable_colliders(collider, offset);
-        return this->get_offset_before_collision(collider, reachable_colliders, offset);
+        this->update_dirty_colliders();
+        transform::UnitVector max_offset = offset;
+        this->visit_reachable_colliders(collider, offset,
+            [&max_offset](const Collider*, const transform::UnitVector& max_distance) {
+                if (max_distance.magnitude()
+                    < max_offset.to(transform::Units::ScenePixels).magnitude())
+                {
+                    max_offset = max_distance;
+                }
+            });
+        return max_offset;
     }
 
     transform::UnitVector CollisionSpace::get_offset_before_collision(const Collider& collider,
@@ -133,9 +386,49 @@ namespace obe::collision
 
     std::vector<ReachableCollider> CollisionSpace::get_reachable_colliders(
         const Collider& collider, const transform::UnitVector& offset) const
+    {
+        std::vector<ReachableCollider> reachable_colliders;
+        this->get_reachable_colliders(collider, offset, reachable_colliders);
+        return reachable_colliders;
+    }
+
+    void CollisionSpace::get_reachable_colliders(const Collider& collider,
+        const transform::UnitVector& offset,
+        std::vector<ReachableCollider>& reachable_colliders) const
+    {
+        this->update_dirty_colliders();
+        this->find_reachable_colliders(collider, offset, reachable_colliders);
+    }
+
+    std::vector<std::vector<ReachableCollider>> CollisionSpace::get_reachable_colliders(
+        const std::vector<CollisionQuery>& queries) const
+    {
+        std::vector<std::vector<ReachableCollider>> reachable_colliders;
+        this->get_reachable_colliders(queries, reachable_colliders);
+        return reachable_colliders;
+    }
+
+    void CollisionSpace::get_reachable_colliders(const std::vector<CollisionQuery>& queries,
+        std::vector<std::vector<ReachableCollider>>& reachable_colliders) const
+    {
+        this->update_dirty_colliders();
+        reachable_colliders.resize(queries.size());
+        for_each_slice(m_narrowphase_pool.get(), queries.size(),
+            [this, &queries, &reachable_colliders](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    this->find_reachable_colliders(
+                        *queries[i].collider, queries[i].offset, reachable_colliders[i]);
+                }
+            });
+    }
+
+    template <class Visitor>
+    void CollisionSpace::visit_reachable_colliders(
+        const Collider& collider, const transform::UnitVector& offset, Visitor&& visitor) const
     {
         const transform::AABB bbox = collider.get_bounding_box();
-        transform::AABB translated_bbox = collider.get_bounding_box();
+        transform::AABB translated_bbox = bbox;
         translated_bbox.move(offset);
 
         const double min_left = std::min(bbox.get_position().x, translated_bbox.get_position().x);
@@ -148,22 +441,193 @@ namespace obe::collision
         transform::AABB trajectory_bbox(transform::UnitVector(min_left, min_top),
             transform::UnitVector(max_right - min_left, max_bottom - min_top));
 
-        std::vector<const Collider*> quadtree_query_results = m_quadtree.query(trajectory_bbox);
+        this->visit_broadphase(trajectory_bbox,
+            [this, &collider, &offset, &visitor](const Collider* space_collider) {
+                if (&collider != space_collider && can_collide_with(collider, *space_collider))
+                {
+                    const transform::UnitVector max_distance
+                        = collider.get_offset_before_collision(*space_collider, offset);
+                    if (max_distance != offset)
+                        visitor(space_collider, max_distance);
+                }
+            });
+    }
 
-        std::vector<ReachableCollider> reachable_colliders;
+    void CollisionSpace::find_reachable_colliders(const Collider& collider,
+        const transform::UnitVector& offset,
+        std::vector<ReachableCollider>& reachable_colliders) const
+    {
+        reachable_colliders.clear();
+        this->visit_reachable_colliders(collider, offset,
+            [&reachable_colliders](
+                const Collider* space_collider, const transform::UnitVector& max_distance) {
+                reachable_colliders.emplace_back(space_collider, max_distance);
+            });
+    }
 
-        for (const Collider* space_collider : quadtree_query_results)
+    std::vector<CollisionPair> CollisionSpace::get_all_collisions() const
+    {
+        this->update_dirty_colliders();
+        std::vector<CollisionPair> candidates;
+        std::visit(
+            [&candidates](const auto& broadphase) { broadphase.find_all_intersections(candidates); },
+            m_broadphase);
+
+        // One flag per candidate so the slices never write to the same element
+        std::vector<char> colliding(candidates.size(), 0);
+        for_each_slice(m_narrowphase_pool.get(), candidates.size(),
+            [this, &candidates, &colliding](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    const auto& [collider1, collider2] = candidates[i];
+                    colliding[i] = can_collide_with(*collider1, *collider2)
+                        && collider1->collides(*collider2);
+                }
+            });
+        std::vector<CollisionPair> collisions;
+        for (std::size_t i = 0; i < candidates.size(); i++)
+        {
+            if (colliding[i])
+            {
+                collisions.push_back(candidates[i]);
+            }
+        }
+        for (CollisionPair& pair : collisions)
         {
-            if (&collider != space_collider && can_collide_with(collider, *space_collider))
+            if (std::less<const Collider*>()(pair.second, pair.first))
             {
-                const transform::UnitVector max_distance
-                    = collider.get_offset_before_collision(*space_collider, offset);
-                if (max_distance != offset)
-                    reachable_colliders.emplace_back(space_collider, max_distance);
+                std::swap(pair.first, pair.second);
             }
         }
+        std::sort(collisions.begin(), collisions.end());
+        return collisions;
+    }
 
-        return reachable_colliders;
+    ContactChanges CollisionSpace::update_contacts()
+    {
+        std::vector<CollisionPair> contacts = this->get_all_collisions();
+        ContactChanges changes;
+        std::set_difference(contacts.begin(), contacts.end(), m_contacts.begin(),
+            m_contacts.end(), std::back_inserter(changes.began));
+        std::set_intersection(contacts.begin(), contacts.end(), m_contacts.begin(),
+            m_contacts.end(), std::back_inserter(changes.stayed));
+        std::set_difference(m_contacts.begin(), m_contacts.end(), contacts.begin(),
+            contacts.end(), std::back_inserter(changes.ended));
+        m_contacts = std::move(contacts);
+        return changes;
+    }
+
+    void CollisionSpace::reset_contacts()
+    {
+        m_contacts.clear();
+    }
+
+    void CollisionSpace::set_narrowphase_workers(std::size_t workers)
+    {
+        if (workers == 0)
+        {
+            m_narrowphase_pool.reset();
+        }
+        else if (!m_narrowphase_pool || m_narrowphase_pool->get_worker_count() != workers)
+        {
+            m_narrowphase_pool = std::make_unique<utils::ThreadPool>(workers);
+        }
+    }
+
+    std::size_t CollisionSpace::get_narrowphase_workers() const
+    {
+        return m_narrowphase_pool ? m_narrowphase_pool->get_worker_count() : 0;
+    }
+
+    void CollisionSpace::set_quadtree_limits(std::size_t threshold, std::size_t max_depth)
+    {
+        if (threshold == 0)
+        {
+            throw exceptions::InvalidQuadtreeThreshold();
+        }
+        if (threshold == m_quadtree_threshold && max_depth == m_quadtree_max_depth)
+        {
+            return;
+        }
+        m_quadtree_threshold = threshold;
+        m_quadtree_max_depth = max_depth;
+        if (const auto* quadtree = std::get_if<Quadtree>(&m_broadphase))
+        {
+            const transform::AABB box = quadtree->get_box();
+            m_broadphase.emplace<Quadtree>(box, threshold, max_depth);
+            this->rebuild_broadphase();
+        }
+    }
+
+    void CollisionSpace::set_broadphase(BroadphaseType type)
+    {
+        if (type == this->get_broadphase())
+        {
+            return;
+        }
+        if (type == BroadphaseType::Quadtree)
+        {
+            m_broadphase.emplace<Quadtree>(
+                fit_world_box(0, 0, 0, 0), m_quadtree_threshold, m_quadtree_max_depth);
+        }
+        else
+        {
+            m_broadphase.emplace<SpatialHashGrid>(m_grid_cell_size);
+        }
+        this->rebuild_broadphase();
+    }
+
+    BroadphaseType CollisionSpace::get_broadphase() const
+    {
+        return std::holds_alternative<Quadtree>(m_broadphase) ? BroadphaseType::Quadtree
+                                                              : BroadphaseType::SpatialHashGrid;
+    }
+
+    void CollisionSpace::set_grid_cell_size(double cell_size)
+    {
+        if (!(cell_size > 0))
+        {
+            throw exceptions::InvalidGridCellSize(cell_size);
+        }
+        if (cell_size == m_grid_cell_size)
+        {
+            return;
+        }
+        m_grid_cell_size = cell_size;
+        if (std::holds_alternative<SpatialHashGrid>(m_broadphase))
+        {
+            m_broadphase.emplace<SpatialHashGrid>(cell_size);
+            this->rebuild_broadphase();
+        }
+    }
+
+    double CollisionSpace::get_grid_cell_size() const
+    {
+        return m_grid_cell_size;
+    }
+
+    transform::AABB CollisionSpace::get_bounds() const
+    {
+        this->update_dirty_colliders();
+        const auto* quadtree = std::get_if<Quadtree>(&m_broadphase);
+        return quadtree ? quadtree->get_box() : transform::AABB();
+    }
+
+    QuadtreeStats CollisionSpace::get_quadtree_stats() const
+    {
+        this->update_dirty_colliders();
+        const auto* quadtree = std::get_if<Quadtree>(&m_broadphase);
+        return quadtree ? quadtree->get_stats() : QuadtreeStats();
+    }
+
+    std::size_t CollisionSpace::get_quadtree_threshold() const
+    {
+        return m_quadtree_threshold;
+    }
+
+    std::size_t CollisionSpace::get_quadtree_max_depth() const
+    {
+        return m_quadtree_max_depth;
     }
 
     void CollisionSpace::add_tag_to_blacklist(const std::string& source_tag,
@@ -174,6 +638,8 @@ namespace obe::collision
             m_tags_blacklists.insert({ source_tag, {} });
         }
         m_tags_blacklists.at(source_tag).insert(rejected_tag);
+        this->set_tag_rejected(
+            ColliderTags::get_id(source_tag), ColliderTags::get_id(rejected_tag), true);
     }
 
     void CollisionSpace::remove_tag_to_blacklist(const std::string& source_tag,
@@ -182,6 +648,8 @@ namespace obe::collision
         if (m_tags_blacklists.contains(source_tag))
         {
             m_tags_blacklists.at(source_tag).erase(rejected_tag);
+            this->set_tag_rejected(
+                ColliderTags::get_id(source_tag), ColliderTags::get_id(rejected_tag), false);
         }
     }
 
@@ -190,6 +658,11 @@ namespace obe::collision
         if (m_tags_blacklists.contains(source_tag))
         {
             m_tags_blacklists.at(source_tag).clear();
+            const ColliderTagId source_tag_id = ColliderTags::get_id(source_tag);
+            if (source_tag_id < m_blacklist_masks.size())
+            {
+                m_blacklist_masks[source_tag_id].clear();
+            }
         }
     }
 
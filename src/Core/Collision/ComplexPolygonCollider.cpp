@@ -1,3 +1,5 @@
+#include <numeric>
+
 #include <Collision/ComplexPolygonCollider.hpp>
 
 namespace obe::collision
@@ -55,6 +57,180 @@ namespace obe::collision
         return full_hull;
     }
 
+    namespace
+    {
+        // Indices of the points of a convex piece, in counter-clockwise order
+        using Piece = std::vector<std::size_t>;
+
+        double signed_area(const std::vector<transform::UnitVector>& points)
+        {
+            double area = 0;
+            for (std::size_t i = 0, j = points.size() - 1; i < points.size(); j = i++)
+            {
+                area += points[j].x * points[i].y - points[i].x * points[j].y;
+            }
+            return area / 2;
+        }
+
+        bool in_triangle(const transform::UnitVector& a, const transform::UnitVector& b,
+            const transform::UnitVector& c, const transform::UnitVector& point)
+        {
+            return cross(a, b, point) >= 0 && cross(b, c, point) >= 0
+                && cross(c, a, point) >= 0;
+        }
+
+        /**
+         * \brief Splits a simple polygon into triangles by clipping its ears
+         */
+        std::vector<Piece> triangulate(const std::vector<transform::UnitVector>& points)
+        {
+            std::vector<std::size_t> remaining(points.size());
+            std::iota(remaining.begin(), remaining.end(), 0);
+            if (signed_area(points) < 0)
+            {
+                std::reverse(remaining.begin(), remaining.end());
+            }
+            std::vector<Piece> triangles;
+            while (remaining.size() > 3)
+            {
+                const std::size_t size = remaining.size();
+                bool clipped = false;
+                for (std::size_t i = 0; i < size && !clipped; i++)
+                {
+                    const std::size_t prev = remaining[(i + size - 1) % size];
+                    const std::size_t current = remaining[i];
+                    const std::size_t next = remaining[(i + 1) % size];
+                    const double corner = cross(points[prev], points[current], points[next]);
+                    // Collinear points add nothing to the shape
+                    if (corner == 0)
+                    {
+                        remaining.erase(remaining.begin() + i);
+                        clipped = true;
+                    }
+                    else if (corner > 0
+                        && std::none_of(remaining.begin(), remaining.end(), [&](std::size_t other) {
+                               return other != prev && other != current && other != next
+                                   && points[other] != points[prev]
+                                   && points[other] != points[current]
+                                   && points[other] != points[next]
+                                   && in_triangle(points[prev], points[current], points[next],
+                                       points[other]);
+                           }))
+                    {
+                        triangles.push_back({ prev, current, next });
+                        remaining.erase(remaining.begin() + i);
+                        clipped = true;
+                    }
+                }
+                // Self-intersecting polygons have no ears left, the rest is fanned out
+                if (!clipped)
+                {
+                    for (std::size_t i = 1; i + 1 < remaining.size(); i++)
+                    {
+                        triangles.push_back({ remaining[0], remaining[i], remaining[i + 1] });
+                    }
+                    return triangles;
+                }
+            }
+            if (remaining.size() == 3
+                && cross(points[remaining[0]], points[remaining[1]], points[remaining[2]]) != 0)
+            {
+                triangles.push_back(remaining);
+            }
+            return triangles;
+        }
+
+        bool is_convex(const std::vector<transform::UnitVector>& points, const Piece& piece)
+        {
+            for (std::size_t i = 0; i < piece.size(); i++)
+            {
+                if (cross(points[piece[i]], points[piece[(i + 1) % piece.size()]],
+                        points[piece[(i + 2) % piece.size()]])
+                    < 0)
+                    return false;
+            }
+            return true;
+        }
+
+        /**
+         * \brief Merges two pieces sharing an edge if the result is a convex polygon
+         *        cute_c2 can handle
+         */
+        bool try_merge(const std::vector<transform::UnitVector>& points, Piece& piece,
+            const Piece& other)
+        {
+            if (piece.size() + other.size() - 2 > C2_MAX_POLYGON_VERTS)
+                return false;
+            for (std::size_t i = 0; i < piece.size(); i++)
+            {
+                const std::size_t start = piece[i];
+                const std::size_t end = piece[(i + 1) % piece.size()];
+                for (std::size_t j = 0; j < other.size(); j++)
+                {
+                    if (other[j] != end || other[(j + 1) % other.size()] != start)
+                        continue;
+                    // Walk piece up to the shared edge, then around other back to it
+                    Piece merged(piece.begin(), piece.begin() + i + 1);
+                    for (std::size_t k = 2; k < other.size(); k++)
+                        merged.push_back(other[(j + k) % other.size()]);
+                    merged.insert(merged.end(), piece.begin() + i + 1, piece.end());
+                    if (!is_convex(points, merged))
+                        return false;
+                    piece = std::move(merged);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * \brief Decomposes a simple polygon into convex pieces of at most
+         *        C2_MAX_POLYGON_VERTS points
+         */
+        std::vector<Piece> decompose(const std::vector<transform::UnitVector>& points)
+        {
+            std::vector<Piece> pieces = triangulate(points);
+            for (std::size_t i = 0; i < pieces.size(); i++)
+            {
+                for (std::size_t j = i + 1; j < pieces.size();)
+                {
+                    if (try_merge(points, pieces[i], pieces[j]))
+                    {
+                        pieces.erase(pieces.begin() + j);
+                        // The grown piece may now share an edge with an earlier one
+                        j = i + 1;
+                    }
+                    else
+                        j++;
+                }
+            }
+            return pieces;
+        }
+    }
+
+    void ComplexPolygonCollider::update_pieces()
+    {
+        m_pieces.clear();
+        if (m_points.size() < 3)
+        {
+            return;
+        }
+        const transform::UnitVector& origin = m_points[0];
+        for (const Piece& piece : decompose(m_points))
+        {
+            c2Poly poly = {};
+            poly.count = static_cast<int>(piece.size());
+            for (std::size_t i = 0; i < piece.size(); i++)
+            {
+                const transform::UnitVector& point = m_points[piece[i]];
+                poly.verts[i] = c2v { static_cast<float>(point.x - origin.x),
+                    static_cast<float>(point.y - origin.y) };
+            }
+            c2MakePoly(&poly);
+            m_pieces.push_back(poly);
+        }
+    }
+
     const void* ComplexPolygonCollider::get_c2_shape() const
     {
         return nullptr;
@@ -62,7 +238,12 @@ namespace obe::collision
 
     const c2x* ComplexPolygonCollider::get_c2_space_transform() const
     {
-        return nullptr;
+        return &m_transform;
+    }
+
+    std::span<const c2Poly> ComplexPolygonCollider::get_c2_pieces() const
+    {
+        return m_pieces;
     }
 
     ColliderType ComplexPolygonCollider::get_collider_type() const
@@ -86,7 +267,11 @@ namespace obe::collision
             {
                 point += offset;
             }
+            // Pieces are relative to the first point, only the transform follows
+            m_transform.p = c2v { static_cast<float>(p_vec.x), static_cast<float>(p_vec.y) };
+            m_bounding_box.move(offset);
         }
+        this->invalidate_bounding_box();
     }
 
     void ComplexPolygonCollider::move(const transform::UnitVector& position)
@@ -103,6 +288,16 @@ namespace obe::collision
         {
             m_points.insert(m_points.begin() + point_index, p_vec);
         }
+        m_transform.p
+            = c2v { static_cast<float>(m_points[0].x), static_cast<float>(m_points[0].y) };
+        auto [min_x, max_x] = std::minmax_element(m_points.begin(), m_points.end(),
+            [](auto& point1, auto& point2) { return point1.x < point2.x; });
+        auto [min_y, max_y] = std::minmax_element(m_points.begin(), m_points.end(),
+            [](auto& point1, auto& point2) { return point1.y < point2.y; });
+        m_bounding_box = transform::AABB(transform::UnitVector(min_x->x, min_y->y),
+            transform::UnitVector(max_x->x - min_x->x, max_y->y - min_y->y));
+        this->update_pieces();
+        this->invalidate_bounding_box();
     }
 
     std::size_t ComplexPolygonCollider::get_points_amount() const
@@ -110,159 +305,19 @@ namespace obe::collision
         return m_points.size();
     }
 
-    bool ComplexPolygonCollider::collides(const Collider& collider) const
+    const std::vector<transform::UnitVector>& ComplexPolygonCollider::get_points() const
     {
-        std::vector<transform::UnitVector> p_set1;
-        p_set1.reserve(m_points.size());
-        std::vector<transform::UnitVector> p_set2;
-        p_set2.reserve(m_points.size());
-
-        if (collider.get_collider_type() != ColliderType::ComplexPolygon)
-        {
-            return false;
-        }
-
-        const ComplexPolygonCollider& polygon_collider
-            = static_cast<const ComplexPolygonCollider&>(collider);
-
-        for (const auto& point : m_points)
-            p_set1.push_back(point);
-        for (const auto& point : polygon_collider.m_points)
-            p_set2.push_back(point);
-        constexpr auto point_in_polygon = [](const std::vector<transform::UnitVector>& poly,
-                                              const transform::UnitVector& p_test) -> bool
-        {
-            int i, j, c = 0;
-            const int n_pt = static_cast<int>(poly.size());
-            for (i = 0, j = n_pt - 1; i < n_pt; j = i++)
-            {
-                if (((poly[i].y > p_test.y) != (poly[j].y > p_test.y))
-                    && (p_test.x
-                        < (poly[j].x - poly[i].x) * (p_test.y - poly[i].y) / (poly[j].y - poly[i].y)
-                            + poly[i].x))
-                    c = !c;
-            }
-            return c;
-        };
-        for (const transform::UnitVector& p_test : p_set1)
-        {
-            if (point_in_polygon(p_set2, p_test))
-                return true;
-        }
-        for (const transform::UnitVector& p_test : p_set2)
-        {
-            if (point_in_polygon(p_set1, p_test))
-                return true;
-        }
+        return m_points;
     }
 
-    transform::UnitVector ComplexPolygonCollider::get_offset_before_collision(
-        const Collider& collider, const transform::UnitVector& self_offset,
-        const transform::UnitVector& other_offset) const
+    std::size_t ComplexPolygonCollider::get_pieces_amount() const
     {
-        constexpr transform::Units px_unit = transform::Units::ScenePixels;
-        const transform::UnitVector t_offset = self_offset.to(px_unit);
-        bool in_front = false;
-        transform::UnitVector min_dep;
-        const auto calc_min_distance_dep = [this](const std::vector<transform::UnitVector>& sol1,
-                                               const std::vector<transform::UnitVector>& sol2,
-                  const transform::UnitVector& t_offset)
-            -> std::tuple<double, transform::UnitVector, bool>
-        {
-            double min_distance = -1;
-            bool in_front = false;
-
-            constexpr transform::Units px_unit = transform::Units::ScenePixels;
-            transform::UnitVector min_displacement(px_unit);
-            transform::UnitVector point1(px_unit);
-            transform::UnitVector point2(px_unit);
-            transform::UnitVector point3(px_unit);
-            transform::UnitVector s1(px_unit);
-            for (auto& current_point : sol1)
-            {
-                const transform::UnitVector point0 = current_point.to(px_unit);
-                for (int i = 0; i < sol2.size(); i++)
-                {
-                    point1 = point0 + t_offset;
-                    point2 = sol2[i].to(px_unit);
-                    point3 = sol2[(i == sol2.size() - 1) ? 0 : i + 1].to(px_unit);
-
-                    s1 = point1 - point0;
-                    const transform::UnitVector s2 = point3 - point2;
-
-                    const double s = (-s1.y * (point0.x - point2.x) + s1.x * (point0.y - point2.y))
-                        / (-s2.x * s1.y + s1.x * s2.y);
-                    const double t = (s2.x * (point0.y - point2.y) - s2.y * (point0.x - point2.x))
-                        / (-s2.x * s1.y + s1.x * s2.y);
-
-                    if (s >= 0 && s <= 1 && t >= 0 && t <= 1)
-                    {
-                        in_front = true;
-                        const transform::UnitVector ip
-                            = point0 + (s1 * transform::UnitVector(t, t, s1.unit));
-
-                        const double distance = std::sqrt(
-                            std::pow((point0.x - ip.x), 2) + std::pow((point0.y - ip.y), 2));
-                        if (distance < min_distance || min_distance == -1)
-                        {
-                            min_distance = distance;
-                            const double x_comp = t * s1.x;
-                            const double y_comp = t * s1.y;
-                            min_displacement.set(
-                                (x_comp > 0) ? std::floor(x_comp) : std::ceil(x_comp),
-                                (y_comp > 0) ? std::floor(y_comp) : std::ceil(y_comp));
-                        }
-                    }
-                }
-            }
-            return std::make_tuple(min_distance, min_displacement, in_front);
-        };
-
-        if (collider.get_collider_type() != ColliderType::ComplexPolygon)
-        {
-            return transform::UnitVector(0, 0);
-        }
-
-        const ComplexPolygonCollider& polygon_collider
-            = static_cast<const ComplexPolygonCollider&>(collider);
-
-        const std::vector<transform::UnitVector>& f_path = m_points;
-        const std::vector<transform::UnitVector>& s_path = polygon_collider.m_points;
-
-        const auto tdm1 = calc_min_distance_dep(f_path, s_path, t_offset);
-        auto tdm2 = calc_min_distance_dep(
-            s_path, f_path, t_offset * transform::UnitVector(-1.0, -1.0, t_offset.unit));
-        std::get<1>(tdm2).x = -std::get<1>(tdm2).x;
-        std::get<1>(tdm2).y = -std::get<1>(tdm2).y;
-        if (std::get<2>(tdm1) || std::get<2>(tdm2))
-            in_front = true;
-
-        if (!in_front)
-            min_dep = t_offset;
-        else if (std::get<0>(tdm1) == 0 || std::get<0>(tdm2) == 0)
-            return transform::UnitVector(0, 0, t_offset.unit);
-        else if (std::get<0>(tdm1) > 0
-            && (std::get<0>(tdm1) <= std::get<0>(tdm2) || std::get<0>(tdm2) == -1))
-            min_dep = std::get<1>(tdm1);
-        else if (std::get<0>(tdm2) > 0)
-            min_dep = std::get<1>(tdm2);
-        else
-            return transform::UnitVector(0, 0, t_offset.unit);
-
-        return min_dep;
+        return m_pieces.size();
     }
 
     transform::AABB ComplexPolygonCollider::get_bounding_box() const
     {
         // TODO: handle rotation
-        auto [min_x, max_x] = std::minmax_element(m_points.begin(), m_points.end(),
-                [](auto& point1, auto& point2) { return point1.x < point2.x; });
-        auto [min_y, max_y]
-            = std::minmax_element(m_points.begin(), m_points.end(),
-                [](auto& point1, auto& point2) { return point1.y < point2.y; });
-        const double width = max_x->x - min_x->x;
-        const double height = max_y->y - min_y->y;
-        return transform::AABB(
-            transform::UnitVector(min_x->x, min_y->y), transform::UnitVector(width, height));
+        return m_bounding_box;
     }
-}
\ No newline at end of file
+}
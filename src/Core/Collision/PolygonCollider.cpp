@@ -52,6 +52,10 @@ namespace obe::collision
     transform::AABB PolygonCollider::get_bounding_box() const
     {
         // TODO: handle rotation
+        if (m_shape.count == 0)
+        {
+            return transform::AABB(m_position, transform::UnitVector(0, 0));
+        }
         const auto verts_span = std::span { m_shape.verts };
         auto [min_x, max_x]
             = std::minmax_element(verts_span.begin(), verts_span.begin() + m_shape.count,
@@ -62,7 +66,8 @@ namespace obe::collision
         const double width = max_x->x - min_x->x;
         const double height = max_y->y - min_y->y;
         return transform::AABB(
-            transform::UnitVector(min_x->x, min_y->y), transform::UnitVector(width, height));
+            transform::UnitVector(m_position.x + min_x->x, m_position.y + min_y->y),
+            transform::UnitVector(width, height));
     }
 
     transform::UnitVector PolygonCollider::get_position() const
@@ -74,12 +79,14 @@ namespace obe::collision
     {
         Collider::set_position(position);
         update_transform();
+        this->invalidate_bounding_box();
     }
 
     void PolygonCollider::move(const transform::UnitVector& position)
     {
         Collider::move(position);
         update_transform();
+        this->invalidate_bounding_box();
     }
 
     void PolygonCollider::add_point(const transform::UnitVector& position, int point_index)
@@ -92,6 +99,7 @@ namespace obe::collision
         m_shape.verts[point_index]
             = c2v { static_cast<float>(position.x), static_cast<float>(position.y) };
         update_shape();
+        this->invalidate_bounding_box();
     }
 
     std::size_t PolygonCollider::get_points_amount() const
@@ -115,12 +123,14 @@ namespace obe::collision
     {
         m_angle = angle;
         update_transform();
+        this->invalidate_bounding_box();
     }
 
     void PolygonCollider::rotate(float angle)
     {
         m_angle += angle;
         update_transform();
+        this->invalidate_bounding_box();
     }
 
     float PolygonCollider::get_rotation() const
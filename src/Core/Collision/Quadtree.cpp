@@ -5,21 +5,46 @@
 
 namespace obe::collision
 {
-    Quadtree::Quadtree(const transform::AABB& box)
+    Quadtree::Quadtree(
+        const transform::AABB& box, std::size_t threshold, std::size_t max_depth)
         : m_box(box)
-        , m_root(std::make_unique<Node>())
+        , m_threshold(threshold)
+        , m_max_depth(max_depth)
     {
+        m_nodes.emplace_back();
     }
 
     void Quadtree::clear()
     {
-        m_root.reset();
-        m_root = std::make_unique<Node>();
+        m_nodes.clear();
+        m_nodes.emplace_back();
+        m_free_children.clear();
     }
 
-    bool Quadtree::is_leaf(const Node* node) const
+    void Quadtree::reset(const transform::AABB& box)
     {
-        return !static_cast<bool>(node->children[0]);
+        m_box = box;
+        this->clear();
+    }
+
+    const transform::AABB& Quadtree::get_box() const
+    {
+        return m_box;
+    }
+
+    std::size_t Quadtree::get_threshold() const
+    {
+        return m_threshold;
+    }
+
+    std::size_t Quadtree::get_max_depth() const
+    {
+        return m_max_depth;
+    }
+
+    bool Quadtree::is_leaf(NodeIndex node) const
+    {
+        return m_nodes[node].children == NoChildren;
     }
 
     transform::AABB Quadtree::compute_box(const transform::AABB& box, int i) const
@@ -81,212 +106,253 @@ namespace obe::collision
             return -1;
     }
 
+    Quadtree::NodeIndex Quadtree::allocate_children()
+    {
+        if (!m_free_children.empty())
+        {
+            const NodeIndex children = m_free_children.back();
+            m_free_children.pop_back();
+            return children;
+        }
+        const auto children = static_cast<NodeIndex>(m_nodes.size());
+        m_nodes.resize(m_nodes.size() + 4);
+        return children;
+    }
+
     void Quadtree::add_internal(
-        Node* node, std::size_t depth, const transform::AABB& box, const Collider* value)
+        NodeIndex node, std::size_t depth, const transform::AABB& box, const Entry& entry)
     {
-        assert(node != nullptr);
-        assert(box.contains(value->get_bounding_box()));
+        assert(node < m_nodes.size());
+        assert(box.contains(entry.box));
         if (is_leaf(node))
         {
             // Insert the value in this node if possible
-            if (depth >= MaxDepth || node->values.size() < Threshold)
-                node->values.push_back(value);
+            if (depth >= m_max_depth || m_nodes[node].values.size() < m_threshold)
+                m_nodes[node].values.push_back(entry);
             // Otherwise, we split and we try again
             else
             {
                 split(node, box);
-                add_internal(node, depth, box, value);
+                add_internal(node, depth, box, entry);
             }
         }
         else
         {
-            auto i = get_quadrant(box, value->get_bounding_box());
+            auto i = get_quadrant(box, entry.box);
             // Add the value in a child if the value is entirely contained in it
             if (i != -1)
-                add_internal(node->children[static_cast<std::size_t>(i)].get(), depth + 1,
-                    compute_box(box, i), value);
+                add_internal(m_nodes[node].children + static_cast<NodeIndex>(i), depth + 1,
+                    compute_box(box, i), entry);
             // Otherwise, we add the value in the current node
             else
-                node->values.push_back(value);
+                m_nodes[node].values.push_back(entry);
         }
     }
 
-    void Quadtree::split(Node* node, const transform::AABB& box)
+    void Quadtree::split(NodeIndex node, const transform::AABB& box)
     {
-        assert(node != nullptr);
+        assert(node < m_nodes.size());
         assert(is_leaf(node) && "Only leaves can be split");
-        // Create children
-        for (auto& child : node->children)
-            child = std::make_unique<Node>();
+        // Create children, this may grow the pool so nodes are only accessed by index
+        const NodeIndex children = allocate_children();
+        m_nodes[node].children = children;
         // Assign values to children
-        auto new_values = std::vector<const Collider*>(); // New values for this node
-        for (const auto& value : node->values)
+        std::vector<Entry>& values = m_nodes[node].values;
+        auto kept = values.begin();
+        for (auto& entry : values)
         {
-            auto i = get_quadrant(box, value->get_bounding_box());
+            auto i = get_quadrant(box, entry.box);
             if (i != -1)
-                node->children[static_cast<std::size_t>(i)]->values.push_back(value);
+                m_nodes[children + static_cast<NodeIndex>(i)].values.push_back(entry);
             else
-                new_values.push_back(value);
+                *kept++ = entry;
         }
-        node->values = std::move(new_values);
+        values.erase(kept, values.end());
     }
 
-    bool Quadtree::remove_internal(Node* node, const transform::AABB& box, const Collider* value)
+    bool Quadtree::remove_internal(NodeIndex node, const transform::AABB& box, const Entry& entry)
     {
-        assert(node != nullptr);
-        assert(box.contains(value->get_bounding_box()));
+        assert(node < m_nodes.size());
+        assert(box.contains(entry.box));
         if (is_leaf(node))
         {
             // Remove the value from node
-            remove_value(node, value);
+            remove_value(node, entry.value);
             return true;
         }
         else
         {
             // Remove the value in a child if the value is entirely contained in it
-            auto i = get_quadrant(box, value->get_bounding_box());
+            auto i = get_quadrant(box, entry.box);
             if (i != -1)
             {
-                if (remove_internal(node->children[static_cast<std::size_t>(i)].get(), compute_box(box, i),
-                        value))
+                if (remove_internal(m_nodes[node].children + static_cast<NodeIndex>(i),
+                        compute_box(box, i), entry))
                     return try_merge(node);
             }
             // Otherwise, we remove the value from the current node
             else
-                remove_value(node, value);
+                remove_value(node, entry.value);
             return false;
         }
     }
 
-    void Quadtree::remove_value(Node* node, const Collider* value)
+    void Quadtree::remove_value(NodeIndex node, const Collider* value)
     {
+        std::vector<Entry>& values = m_nodes[node].values;
         // Find the value in node->values
-        auto it = std::find_if(std::begin(node->values), std::end(node->values),
-            [this, &value](const auto& rhs) { return value == rhs; });
-        assert(it != std::end(node->values)
+        auto it = std::find_if(std::begin(values), std::end(values),
+            [&value](const auto& rhs) { return value == rhs.value; });
+        assert(it != std::end(values)
             && "Trying to remove a value that is not present in the node");
         // Swap with the last element and pop back
-        *it = std::move(node->values.back());
-        node->values.pop_back();
+        *it = std::move(values.back());
+        values.pop_back();
     }
 
-    bool Quadtree::try_merge(Node* node)
+    bool Quadtree::try_merge(NodeIndex node)
     {
-        assert(node != nullptr);
+        assert(node < m_nodes.size());
         assert(!is_leaf(node) && "Only interior nodes can be merged");
-        auto nbValues = node->values.size();
-        for (const auto& child : node->children)
+        const NodeIndex children = m_nodes[node].children;
+        auto nbValues = m_nodes[node].values.size();
+        for (auto child = children; child < children + 4; ++child)
         {
-            if (!is_leaf(child.get()))
+            if (!is_leaf(child))
                 return false;
-            nbValues += child->values.size();
+            nbValues += m_nodes[child].values.size();
         }
-        if (nbValues <= Threshold)
+        if (nbValues <= m_threshold)
         {
-            node->values.reserve(nbValues);
-            // Merge the values of all the children
-            for (const auto& child : node->children)
+            std::vector<Entry>& values = m_nodes[node].values;
+            values.reserve(nbValues);
+            // Merge the values of all the children, their buffers keep their capacity
+            for (auto child = children; child < children + 4; ++child)
             {
-                for (const auto& value : child->values)
-                    node->values.push_back(value);
+                values.insert(
+                    values.end(), m_nodes[child].values.begin(), m_nodes[child].values.end());
+                m_nodes[child].values.clear();
             }
-            // Remove the children
-            for (auto& child : node->children)
-                child.reset();
+            // Give the children back to the pool
+            m_nodes[node].children = NoChildren;
+            m_free_children.push_back(children);
             return true;
         }
         else
             return false;
     }
 
-    void Quadtree::query_internal(Node* node, const transform::AABB& box,
-        const transform::AABB& query_box, std::vector<const Collider*>& values) const
-    {
-        assert(node != nullptr);
-        assert(query_box.intersects(box));
-        for (const auto& value : node->values)
-        {
-            if (query_box.intersects(value->get_bounding_box()))
-                values.push_back(value);
-        }
-        if (!is_leaf(node))
-        {
-            for (auto i = std::size_t(0); i < node->children.size(); ++i)
-            {
-                auto child_box = compute_box(box, static_cast<int>(i));
-                if (query_box.intersects(child_box))
-                    query_internal(node->children[i].get(), child_box, query_box, values);
-            }
-        }
-    }
-
-    void Quadtree::find_all_intersections_internal(
-        Node* node, std::vector<std::pair<const Collider*, const Collider*>>& intersections) const
+    void Quadtree::find_all_intersections_internal(NodeIndex node,
+        std::vector<std::pair<const Collider*, const Collider*>>& intersections) const
     {
+        const std::vector<Entry>& values = m_nodes[node].values;
         // Find intersections between values stored in this node
         // Make sure to not report the same intersection twice
-        for (auto i = std::size_t(0); i < node->values.size(); ++i)
+        for (auto i = std::size_t(0); i < values.size(); ++i)
         {
             for (auto j = std::size_t(0); j < i; ++j)
             {
-                if (node->values[i]->get_bounding_box().intersects(
-                        node->values[j]->get_bounding_box()))
-                    intersections.emplace_back(node->values[i], node->values[j]);
+                if (values[i].box.intersects(values[j].box))
+                    intersections.emplace_back(values[i].value, values[j].value);
             }
         }
         if (!is_leaf(node))
         {
+            const NodeIndex children = m_nodes[node].children;
             // Values in this node can intersect values in descendants
-            for (const auto& child : node->children)
+            for (auto child = children; child < children + 4; ++child)
             {
-                for (const auto& value : node->values)
-                    find_intersections_in_descendants(child.get(), value, intersections);
+                for (const auto& entry : values)
+                    find_intersections_in_descendants(child, entry, intersections);
             }
             // Find intersections in children
-            for (const auto& child : node->children)
-                find_all_intersections_internal(child.get(), intersections);
+            for (auto child = children; child < children + 4; ++child)
+                find_all_intersections_internal(child, intersections);
         }
     }
 
-    void Quadtree::find_intersections_in_descendants(Node* node, const Collider* value,
+    void Quadtree::find_intersections_in_descendants(NodeIndex node, const Entry& entry,
         std::vector<std::pair<const Collider*, const Collider*>>& intersections) const
     {
         // Test against the values stored in this node
-        for (const auto& other : node->values)
+        for (const auto& other : m_nodes[node].values)
         {
-            if (value->get_bounding_box().intersects(other->get_bounding_box()))
-                intersections.emplace_back(value, other);
+            if (entry.box.intersects(other.box))
+                intersections.emplace_back(entry.value, other.value);
         }
         // Test against values stored into descendants of this node
         if (!is_leaf(node))
         {
-            for (const auto& child : node->children)
-                find_intersections_in_descendants(child.get(), value, intersections);
+            const NodeIndex children = m_nodes[node].children;
+            for (auto child = children; child < children + 4; ++child)
+                find_intersections_in_descendants(child, entry, intersections);
         }
     }
 
-    void Quadtree::add(const Collider* value)
+    void Quadtree::add(const Collider* value, const transform::AABB& box)
     {
-        add_internal(m_root.get(), 0, m_box, value);
+        add_internal(0, 0, m_box, Entry { value, box });
     }
 
-    void Quadtree::remove(const Collider* value)
+    void Quadtree::remove(const Collider* value, const transform::AABB& box)
     {
-        remove_internal(m_root.get(), m_box, value);
+        remove_internal(0, m_box, Entry { value, box });
     }
 
     std::vector<const Collider*> Quadtree::query(const transform::AABB& box) const
     {
         auto values = std::vector<const Collider*>();
-        query_internal(m_root.get(), m_box, box, values);
+        query(box, values);
         return values;
     }
 
+    void Quadtree::query(const transform::AABB& box, std::vector<const Collider*>& values) const
+    {
+        values.clear();
+        visit(box, [&values](const Collider* value) { values.push_back(value); });
+    }
+
     std::vector<std::pair<const Collider*, const Collider*>>
     Quadtree::find_all_intersections() const
     {
         auto intersections = std::vector<std::pair<const Collider*, const Collider*>>();
-        find_all_intersections_internal(m_root.get(), intersections);
+        find_all_intersections(intersections);
         return intersections;
     }
-}
\ No newline at end of file
+
+    void Quadtree::find_all_intersections(
+        std::vector<std::pair<const Collider*, const Collider*>>& intersections) const
+    {
+        intersections.clear();
+        find_all_intersections_internal(0, intersections);
+    }
+
+    void Quadtree::collect_stats(NodeIndex node, std::size_t depth, QuadtreeStats& stats) const
+    {
+        const std::size_t values = m_nodes[node].values.size();
+        stats.nodes++;
+        stats.values += values;
+        if (is_leaf(node))
+        {
+            stats.leaves++;
+            stats.depth = std::max(stats.depth, depth);
+            stats.max_leaf_values = std::max(stats.max_leaf_values, values);
+        }
+        else
+        {
+            stats.interior_values += values;
+            const NodeIndex children = m_nodes[node].children;
+            for (auto child = children; child < children + 4; ++child)
+                collect_stats(child, depth + 1, stats);
+        }
+    }
+
+    QuadtreeStats Quadtree::get_stats() const
+    {
+        QuadtreeStats stats;
+        collect_stats(0, 0, stats);
+        stats.average_leaf_values
+            = static_cast<double>(stats.values - stats.interior_values) / stats.leaves;
+        return stats;
+    }
+}
@@ -64,17 +64,20 @@ namespace obe::collision
     {
         m_size.set(size);
         update_shape();
+        this->invalidate_bounding_box();
     }
 
     void RectangleCollider::set_position(const transform::UnitVector& position)
     {
         Movable::set_position(position);
         update_shape();
+        this->invalidate_bounding_box();
     }
 
     void RectangleCollider::move(const transform::UnitVector& position)
     {
         Movable::move(position);
         update_shape();
+        this->invalidate_bounding_box();
     }
 }
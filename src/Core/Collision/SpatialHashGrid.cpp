@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include <Collision/SpatialHashGrid.hpp>
+
+namespace obe::collision
+{
+    // Cell coordinates are clamped so that cell ranges never overflow
+    constexpr double MAX_CELL_COORDINATE = 1 << 30;
+    // Below this amount, empty cells are never worth freeing
+    constexpr std::size_t MIN_PRUNED_CELLS = 64;
+
+    std::size_t SpatialHashGrid::CellRange::size() const
+    {
+        return static_cast<std::size_t>(std::int64_t(max_x) - min_x + 1)
+            * static_cast<std::size_t>(std::int64_t(max_y) - min_y + 1);
+    }
+
+    SpatialHashGrid::SpatialHashGrid(double cell_size)
+        : m_cell_size(cell_size)
+    {
+        assert(cell_size > 0 && "Cells need a positive size");
+    }
+
+    std::int32_t SpatialHashGrid::to_cell(double coordinate) const
+    {
+        return static_cast<std::int32_t>(std::clamp(
+            std::floor(coordinate / m_cell_size), -MAX_CELL_COORDINATE, MAX_CELL_COORDINATE));
+    }
+
+    SpatialHashGrid::CellRange SpatialHashGrid::get_cells(const transform::AABB& box) const
+    {
+        return CellRange { to_cell(box.x()), to_cell(box.y()), to_cell(box.x() + box.width()),
+            to_cell(box.y() + box.height()) };
+    }
+
+    SpatialHashGrid::CellKey SpatialHashGrid::get_key(std::int32_t x, std::int32_t y)
+    {
+        return (CellKey(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+    }
+
+    SpatialHashGrid::CellKey SpatialHashGrid::get_owner_cell(
+        const transform::AABB& box1, const transform::AABB& box2) const
+    {
+        return get_key(
+            to_cell(std::max(box1.x(), box2.x())), to_cell(std::max(box1.y(), box2.y())));
+    }
+
+    void SpatialHashGrid::prune_empty_cells()
+    {
+        std::erase_if(m_cells, [](const auto& cell) { return cell.second.empty(); });
+        m_empty_cells = 0;
+    }
+
+    void SpatialHashGrid::clear()
+    {
+        // Cells left unused since the last clear are freed, the others keep their buffers
+        this->prune_empty_cells();
+        for (auto& [key, entries] : m_cells)
+        {
+            entries.clear();
+        }
+        m_empty_cells = m_cells.size();
+        m_large_values.clear();
+    }
+
+    double SpatialHashGrid::get_cell_size() const
+    {
+        return m_cell_size;
+    }
+
+    void SpatialHashGrid::add(const Collider* value, const transform::AABB& box)
+    {
+        const CellRange range = get_cells(box);
+        if (range.size() > MaxCellsPerValue)
+        {
+            m_large_values.push_back(Entry { value, box });
+            return;
+        }
+        for (std::int32_t y = range.min_y; y <= range.max_y; ++y)
+        {
+            for (std::int32_t x = range.min_x; x <= range.max_x; ++x)
+            {
+                const auto [cell, inserted] = m_cells.try_emplace(get_key(x, y));
+                if (!inserted && cell->second.empty())
+                    m_empty_cells--;
+                cell->second.push_back(Entry { value, box });
+            }
+        }
+    }
+
+    void SpatialHashGrid::remove(const Collider* value, const transform::AABB& box)
+    {
+        const auto remove_from = [value](std::vector<Entry>& entries) {
+            auto it = std::find_if(entries.begin(), entries.end(),
+                [value](const Entry& entry) { return entry.value == value; });
+            assert(it != entries.end()
+                && "Trying to remove a value that is not present in the cell");
+            *it = entries.back();
+            entries.pop_back();
+        };
+        const CellRange range = get_cells(box);
+        if (range.size() > MaxCellsPerValue)
+        {
+            remove_from(m_large_values);
+            return;
+        }
+        for (std::int32_t y = range.min_y; y <= range.max_y; ++y)
+        {
+            for (std::int32_t x = range.min_x; x <= range.max_x; ++x)
+            {
+                std::vector<Entry>& entries = m_cells.at(get_key(x, y));
+                remove_from(entries);
+                if (entries.empty())
+                    m_empty_cells++;
+            }
+        }
+        if (m_empty_cells > MIN_PRUNED_CELLS && m_empty_cells * 2 > m_cells.size())
+        {
+            this->prune_empty_cells();
+        }
+    }
+
+    std::vector<const Collider*> SpatialHashGrid::query(const transform::AABB& box) const
+    {
+        auto values = std::vector<const Collider*>();
+        query(box, values);
+        return values;
+    }
+
+    void SpatialHashGrid::query(
+        const transform::AABB& box, std::vector<const Collider*>& values) const
+    {
+        values.clear();
+        visit(box, [&values](const Collider* value) { values.push_back(value); });
+    }
+
+    std::vector<std::pair<const Collider*, const Collider*>>
+    SpatialHashGrid::find_all_intersections() const
+    {
+        auto intersections = std::vector<std::pair<const Collider*, const Collider*>>();
+        find_all_intersections(intersections);
+        return intersections;
+    }
+
+    void SpatialHashGrid::find_all_intersections(
+        std::vector<std::pair<const Collider*, const Collider*>>& intersections) const
+    {
+        intersections.clear();
+        // Pairs sharing several cells are only reported by the cell owning their overlap
+        for (const auto& [key, entries] : m_cells)
+        {
+            for (auto i = std::size_t(0); i < entries.size(); ++i)
+            {
+                for (auto j = std::size_t(0); j < i; ++j)
+                {
+                    if (entries[i].box.intersects(entries[j].box)
+                        && get_owner_cell(entries[i].box, entries[j].box) == key)
+                        intersections.emplace_back(entries[i].value, entries[j].value);
+                }
+            }
+        }
+        for (auto i = std::size_t(0); i < m_large_values.size(); ++i)
+        {
+            const Entry& large = m_large_values[i];
+            for (auto j = std::size_t(0); j < i; ++j)
+            {
+                if (large.box.intersects(m_large_values[j].box))
+                    intersections.emplace_back(large.value, m_large_values[j].value);
+            }
+            auto report = [&intersections, &large](const Collider* value) {
+                intersections.emplace_back(large.value, value);
+                return true;
+            };
+            visit_cells(large.box, report);
+        }
+    }
+}
@@ -85,6 +85,17 @@ namespace obe::collision
         return *this;
     }
 
+    Trajectory& Trajectory::set_substep_length(const double length)
+    {
+        const bool trigger_change = (m_substep_length != length);
+        m_substep_length = length;
+        if (m_on_change_callback && trigger_change)
+        {
+            m_on_change_callback(*this, "substep_length");
+        }
+        return *this;
+    }
+
     const ReachableColliderAcceptor& Trajectory::get_reachable_collider_acceptor() const
     {
         return m_reachable_collider_acceptor;
@@ -110,6 +121,11 @@ namespace obe::collision
         return m_acceleration;
     }
 
+    double Trajectory::get_substep_length() const
+    {
+        return m_substep_length;
+    }
+
     bool Trajectory::is_static() const
     {
         return m_static;
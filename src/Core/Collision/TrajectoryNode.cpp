@@ -1,10 +1,12 @@
+#include <algorithm>
 #include <cmath>
+#include <optional>
 
 #include <Collision/Exceptions.hpp>
 #include <Collision/TrajectoryNode.hpp>
+#include <Collision/TrajectorySystem.hpp>
 #include <Utils/MathUtils.hpp>
 
-#include <Debug/Logger.hpp> // TODO: Remove logs
 
 namespace obe::collision
 {
@@ -13,6 +15,18 @@ namespace obe::collision
     {
     }
 
+    TrajectoryNode::TrajectoryNode(scene::SceneNode& scene_node, TrajectorySystem& system)
+        : m_scene_node(scene_node)
+    {
+        system.add(*this);
+    }
+
+    TrajectoryNode::~TrajectoryNode()
+    {
+        if (m_system)
+            m_system->remove(*this);
+    }
+
     void TrajectoryNode::set_probe(CollisionSpace const* collision_space, Collider* probe)
     {
         m_collision_space = collision_space;
@@ -21,22 +35,36 @@ namespace obe::collision
 
     Trajectory& TrajectoryNode::add_trajectory(const std::string& id, transform::Units unit)
     {
-        if (m_trajectories.contains(id))
+        const auto it = std::find_if(m_trajectories.begin(), m_trajectories.end(),
+            [&id](const TrajectoryEntry& entry) { return entry.id == id; });
+        if (it != m_trajectories.end())
         {
             throw exceptions::TrajectoryAlreadyExists(id);
         }
-        m_trajectories[id] = std::make_unique<Trajectory>(unit);
-        return *m_trajectories[id];
+        m_trajectories.push_back(TrajectoryEntry { id, std::make_unique<Trajectory>(unit) });
+        return *m_trajectories.back().trajectory;
     }
 
     Trajectory& TrajectoryNode::get_trajectory(const std::string& id) const
     {
-        return *m_trajectories.at(id);
+        const auto it = std::find_if(m_trajectories.begin(), m_trajectories.end(),
+            [&id](const TrajectoryEntry& entry) { return entry.id == id; });
+        if (it == m_trajectories.end())
+        {
+            throw exceptions::UnknownTrajectory(id);
+        }
+        return *it->trajectory;
     }
 
     void TrajectoryNode::remove_trajectory(const std::string& id)
     {
-        m_trajectories.erase(id);
+        std::erase_if(
+            m_trajectories, [&id](const TrajectoryEntry& entry) { return entry.id == id; });
+    }
+
+    TrajectorySystem* TrajectoryNode::get_system() const
+    {
+        return m_system;
     }
 
     transform::UnitVector make_offset_normal(const transform::UnitVector& offset)
@@ -55,7 +83,35 @@ namespace obe::collision
         }
     }
 
+    transform::UnitVector TrajectoryNode::get_offset_before_collision(Trajectory& trajectory,
+        const transform::UnitVector& offset, std::vector<ReachableCollider>& reachable_colliders,
+        std::vector<ReachableCollider>& accepted_colliders) const
+    {
+        m_collision_space->get_reachable_colliders(*m_probe, offset, reachable_colliders);
+        const auto& acceptor = trajectory.get_reachable_collider_acceptor();
+        if (!acceptor)
+        {
+            return m_collision_space->get_offset_before_collision(
+                *m_probe, reachable_colliders, offset);
+        }
+        accepted_colliders.clear();
+        for (const ReachableCollider& reachable_collider : reachable_colliders)
+        {
+            if (acceptor(trajectory, reachable_collider.first))
+                accepted_colliders.push_back(reachable_collider);
+        }
+        return m_collision_space->get_offset_before_collision(
+            *m_probe, accepted_colliders, offset);
+    }
+
     void TrajectoryNode::update(const double dt) const
+    {
+        this->update(dt, m_reachable_colliders, m_accepted_colliders);
+    }
+
+    void TrajectoryNode::update(const double dt,
+        std::vector<ReachableCollider>& reachable_colliders,
+        std::vector<ReachableCollider>& accepted_colliders) const
     {
         auto get_offset = [&dt](const Trajectory& trajectory) {
             const double speed = trajectory.get_speed() + trajectory.get_acceleration() * dt;
@@ -64,57 +120,69 @@ namespace obe::collision
             const double y_offset = std::sin(rad_angle) * (speed * dt);
             return transform::UnitVector(x_offset, y_offset, trajectory.get_unit());
         };
-        for (auto& trajectory : m_trajectories)
+        const bool has_probe = m_probe != nullptr && m_collision_space != nullptr;
+        // Without a probe nothing can stop the SceneNode, offsets sharing a unit are
+        // summed so it is only moved once
+        std::optional<transform::UnitVector> pending_offset;
+        for (std::size_t i = 0; i < m_trajectories.size(); i++)
         {
-            Trajectory* current_trajectory = trajectory.second.get();
-            if (current_trajectory->is_enabled())
+            Trajectory& trajectory = *m_trajectories[i].trajectory;
+            if (!trajectory.is_enabled())
+                continue;
+            auto base_offset = get_offset(trajectory);
+            for (TrajectoryCheckFunction& check : trajectory.get_checks())
             {
-                auto base_offset = get_offset(*current_trajectory);
-
-                for (TrajectoryCheckFunction& check : trajectory.second->get_checks())
-                {
-                    check(*current_trajectory, base_offset, m_probe);
-                }
-                if (!current_trajectory->is_static())
+                check(trajectory, base_offset, m_probe);
+            }
+            if (trajectory.is_static())
+                continue;
+            trajectory.m_speed = trajectory.m_speed + trajectory.m_acceleration * dt;
+            base_offset = get_offset(trajectory);
+            if (base_offset.x == 0 && base_offset.y == 0)
+                continue;
+            if (!has_probe)
+            {
+                if (pending_offset && pending_offset->unit != base_offset.unit)
                 {
-                    current_trajectory->m_speed
-                        = current_trajectory->m_speed + current_trajectory->m_acceleration * dt;
-                    base_offset = get_offset(*current_trajectory);
-                    obe::collision::CollisionData collision_data;
-                    collision_data.offset = base_offset;
-                    if (m_probe != nullptr && m_collision_space != nullptr)
-                    {
-                        std::vector<ReachableCollider> reachable_colliders
-                            = m_collision_space->get_reachable_colliders(
-                                *m_probe, collision_data.offset);
-                        std::vector<ReachableCollider> reachable_and_validated_colliders;
-                        auto trajectory_reachable_collider_acceptor
-                            = trajectory.second->get_reachable_collider_acceptor();
-                        for (const ReachableCollider& reachable_collider : reachable_colliders)
-                        {
-                            if (!trajectory_reachable_collider_acceptor
-                                || trajectory_reachable_collider_acceptor(
-                                    *trajectory.second, reachable_collider.first))
-                            {
-                                reachable_and_validated_colliders.push_back(reachable_collider);
-                            }
-                        }
-                        collision_data.offset = m_collision_space->get_offset_before_collision(
-                            *m_probe, reachable_and_validated_colliders, collision_data.offset);
-                        /* debug::Log->debug(
-                            "<TrajectoryNode> Trajectory '{}'\tBase Offset {}\tOffset {}\tNormal {}\tTOI {}\tDT {}",
-                            trajectory.first, base_offset, collision_data.offset, offset_normal, collision_data.offset.x / base_offset.x, dt);*/
-                    }
-
-                    m_scene_node.move(collision_data.offset);
-                    auto on_collide_callback = trajectory.second->get_on_collide_callback();
-                    if (collision_data.offset != base_offset && on_collide_callback)
-                    {
-                        on_collide_callback(*trajectory.second, collision_data.offset, m_probe);
-                    }
+                    m_scene_node.move(*pending_offset);
+                    pending_offset.reset();
                 }
+                if (pending_offset)
+                    *pending_offset += base_offset;
+                else
+                    pending_offset = base_offset;
+                continue;
+            }
+
+            // Substeps are checked one after the other, the first blocked one ends the move
+            const double distance = base_offset.magnitude();
+            const double substep_length = trajectory.get_substep_length();
+            std::size_t substeps = 1;
+            if (substep_length > 0 && distance > substep_length)
+            {
+                substeps = std::min(Trajectory::MaxSubsteps,
+                    static_cast<std::size_t>(std::ceil(distance / substep_length)));
+            }
+            const transform::UnitVector substep_offset
+                = base_offset / static_cast<double>(substeps);
+            transform::UnitVector offset(base_offset.unit);
+            bool blocked = false;
+            for (std::size_t substep = 0; substep < substeps && !blocked; substep++)
+            {
+                const transform::UnitVector reachable_offset = this->get_offset_before_collision(
+                    trajectory, substep_offset, reachable_colliders, accepted_colliders);
+                m_scene_node.move(reachable_offset);
+                offset += reachable_offset;
+                blocked = (reachable_offset != substep_offset);
+            }
+            const OnCollideCallback& on_collide_callback = trajectory.get_on_collide_callback();
+            if (blocked && on_collide_callback)
+            {
+                on_collide_callback(trajectory, offset, m_probe);
             }
         }
+        if (pending_offset)
+            m_scene_node.move(*pending_offset);
     }
 
     scene::SceneNode& TrajectoryNode::get_scene_node() const
@@ -0,0 +1,115 @@
+#include <algorithm>
+
+#include <Collision/TrajectorySystem.hpp>
+
+namespace obe::collision
+{
+    TrajectorySystem::TrajectorySystem()
+        : Togglable(true)
+    {
+    }
+
+    TrajectorySystem::~TrajectorySystem()
+    {
+        this->clear();
+    }
+
+    void TrajectorySystem::compact()
+    {
+        std::erase(m_nodes, nullptr);
+        for (std::size_t i = 0; i < m_nodes.size(); i++)
+        {
+            m_nodes[i]->m_system_index = i;
+        }
+        m_has_holes = false;
+    }
+
+    void TrajectorySystem::add(TrajectoryNode& node)
+    {
+        if (node.m_system == this)
+            return;
+        if (node.m_system)
+            node.m_system->remove(node);
+        node.m_system = this;
+        node.m_system_index = m_nodes.size();
+        m_nodes.push_back(&node);
+    }
+
+    void TrajectorySystem::remove(TrajectoryNode& node)
+    {
+        if (node.m_system != this)
+            return;
+        if (m_updating)
+        {
+            m_nodes[node.m_system_index] = nullptr;
+            m_has_holes = true;
+        }
+        else
+        {
+            m_nodes.erase(m_nodes.begin() + static_cast<std::ptrdiff_t>(node.m_system_index));
+            for (std::size_t i = node.m_system_index; i < m_nodes.size(); i++)
+            {
+                m_nodes[i]->m_system_index = i;
+            }
+        }
+        node.m_system = nullptr;
+    }
+
+    void TrajectorySystem::remove_nodes(const scene::SceneNode& scene_node)
+    {
+        for (TrajectoryNode*& node : m_nodes)
+        {
+            if (node && &node->m_scene_node == &scene_node)
+            {
+                node->m_system = nullptr;
+                node = nullptr;
+                m_has_holes = true;
+            }
+        }
+        if (m_has_holes && !m_updating)
+            this->compact();
+    }
+
+    void TrajectorySystem::clear()
+    {
+        for (TrajectoryNode*& node : m_nodes)
+        {
+            if (node)
+            {
+                node->m_system = nullptr;
+                node = nullptr;
+            }
+        }
+        if (m_updating)
+            m_has_holes = true;
+        else
+            m_nodes.clear();
+    }
+
+    bool TrajectorySystem::contains(const TrajectoryNode& node) const
+    {
+        return node.m_system == this;
+    }
+
+    std::size_t TrajectorySystem::get_nodes_amount() const
+    {
+        return m_nodes.size() - std::count(m_nodes.begin(), m_nodes.end(), nullptr);
+    }
+
+    void TrajectorySystem::update(const double dt)
+    {
+        if (!m_enabled)
+            return;
+        // Callbacks may add or remove nodes, added nodes wait for the next update
+        m_updating = true;
+        const std::size_t nodes_amount = m_nodes.size();
+        for (std::size_t i = 0; i < nodes_amount; i++)
+        {
+            if (const TrajectoryNode* node = m_nodes[i])
+                node->update(dt, m_reachable_colliders, m_accepted_colliders);
+        }
+        m_updating = false;
+        if (m_has_holes)
+            this->compact();
+    }
+} // namespace obe::collision
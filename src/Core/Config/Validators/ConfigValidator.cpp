@@ -177,6 +177,12 @@ namespace obe::config::validators
                                     {"type", vili::boolean_typename},
                                     {"optional", true}
                                 }
+                            },
+                            {
+                                "textureAtlas", vili::object {
+                                    {"type", vili::boolean_typename},
+                                    {"optional", true}
+                                }
                             }
                         }
                     }
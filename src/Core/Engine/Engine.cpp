@@ -107,6 +107,12 @@ namespace obe::engine
                 debug::Log->debug("<ResourceManager> AntiAliasing Default is {}",
                     m_resources->default_anti_aliasing);
             }
+            if (game_config.contains("textureAtlas"))
+            {
+                m_resources->use_texture_atlas = game_config.at("textureAtlas");
+                debug::Log->debug("<ResourceManager> Texture Atlas is {}",
+                    m_resources->use_texture_atlas);
+            }
         }
     }
 
@@ -334,7 +340,7 @@ namespace obe::engine
         }
 
         m_framerate->start();
-        const time::TimeUnit start = time::epoch();
+        const time::TimeUnit start = time::monotonic();
         while (m_window->is_open())
         {
             m_framerate->update();
@@ -357,7 +363,7 @@ namespace obe::engine
                 // m_lua->collect_garbage();
             }
         }
-        time::TimeUnit total_time = time::epoch() - start;
+        time::TimeUnit total_time = time::monotonic() - start;
         debug::Log->info("Execution completed in {} seconds", total_time);
     }
 
@@ -426,10 +432,14 @@ namespace obe::engine
         // Events
         this->handle_window_events();
 
+        m_resources->update();
+        m_scene->get_trajectory_system().update(m_framerate->get_delta_time());
         m_scene->update();
         m_events->update();
         m_input->update();
         m_cursor->update();
+        // Queued EventGroups deliver the events of the frame before Game.Update
+        m_events->flush();
     }
 
     void Engine::render() const
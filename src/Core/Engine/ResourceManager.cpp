@@ -1,13 +1,104 @@
+#include <algorithm>
+#include <chrono>
+
+#include <Debug/Logger.hpp>
 #include <Engine/Exceptions.hpp>
 #include <Engine/ResourceManager.hpp>
 #include <System/Path.hpp>
+#include <Utils/StringUtils.hpp>
 
 namespace obe::engine
 {
+    const graphics::Texture& ResourceManager::store_texture(
+        const std::string& path, graphics::Texture texture, bool anti_aliasing)
+    {
+        texture.set_anti_aliasing(anti_aliasing);
+        std::unique_ptr<graphics::Texture>& slot
+            = (anti_aliasing) ? m_textures[path].second : m_textures[path].first;
+        slot = std::make_unique<graphics::Texture>(texture);
+        return *slot;
+    }
+
+    utils::ThreadPool& ResourceManager::get_loader_pool()
+    {
+        if (!m_loader_pool)
+        {
+            m_loader_pool = std::make_unique<utils::ThreadPool>(
+                std::min<std::size_t>(utils::ThreadPool::default_worker_count(), 4));
+        }
+        return *m_loader_pool;
+    }
+
+    std::vector<ResourceManager::PendingTexture>::iterator ResourceManager::find_pending_texture(
+        const std::string& path, bool anti_aliasing)
+    {
+        return std::find_if(m_pending_textures.begin(), m_pending_textures.end(),
+            [&path, anti_aliasing](const PendingTexture& pending) {
+                return pending.path == path && pending.anti_aliasing == anti_aliasing;
+            });
+    }
+
+    std::vector<ResourceManager::PendingFont>::iterator ResourceManager::find_pending_font(
+        const std::string& path)
+    {
+        return std::find_if(m_pending_fonts.begin(), m_pending_fonts.end(),
+            [&path](const PendingFont& pending) { return pending.path == path; });
+    }
+
+    void ResourceManager::finish_texture_loading(PendingTexture& pending)
+    {
+        const std::optional<sf::Image> image = pending.image.get();
+        TexturePair& cached = m_textures[pending.path];
+        std::unique_ptr<graphics::Texture>& slot
+            = (pending.anti_aliasing) ? cached.second : cached.first;
+        if (!image || !slot)
+        {
+            debug::Log->error(
+                "[ResourceManager] Could not load <Texture> {} from {} in background",
+                pending.path, pending.source);
+            slot.reset();
+            return;
+        }
+        // Uploads in the shared sf::Texture so every copy of the placeholder gets the pixels
+        slot->load_from_image(image.value());
+        slot->set_anti_aliasing(pending.anti_aliasing);
+        debug::Log->debug("[ResourceManager] Uploaded <Texture> {} loaded in background",
+            pending.path);
+        for (const TextureLoadedCallback& callback : pending.callbacks)
+        {
+            callback(*slot);
+        }
+    }
+
+    void ResourceManager::finish_font_loading(PendingFont& pending)
+    {
+        std::unique_ptr<graphics::Font> font = pending.font.get();
+        if (!font)
+        {
+            debug::Log->error(
+                "[ResourceManager] Could not load <Font> {} in background", pending.path);
+            m_fonts.erase(pending.path);
+            return;
+        }
+        const std::shared_ptr<graphics::Font> cached = m_fonts[pending.path];
+        *cached = *font;
+        for (const FontLoadedCallback& callback : pending.callbacks)
+        {
+            callback(cached);
+        }
+    }
+
     const graphics::Texture& ResourceManager::get_texture(
         const system::Path& path, bool anti_aliasing)
     {
         const std::string path_as_string = path.to_string();
+        if (const auto pending = this->find_pending_texture(path_as_string, anti_aliasing);
+            pending != m_pending_textures.end())
+        {
+            PendingTexture loading = std::move(*pending);
+            m_pending_textures.erase(pending);
+            this->finish_texture_loading(loading);
+        }
         if (!m_textures.contains(path_as_string)
             || (!m_textures[path_as_string].first && !anti_aliasing)
             || (!m_textures[path_as_string].second && anti_aliasing))
@@ -20,19 +111,7 @@ namespace obe::engine
 
             if (temp_texture.load_from_file(texture_path))
             {
-                temp_texture.set_anti_aliasing(anti_aliasing);
-                if (!anti_aliasing)
-                {
-                    m_textures[path_as_string].first
-                        = std::make_unique<graphics::Texture>(temp_texture);
-                    return *m_textures[path_as_string].first;
-                }
-                else
-                {
-                    m_textures[path_as_string].second
-                        = std::make_unique<graphics::Texture>(temp_texture);
-                    return *m_textures[path_as_string].second;
-                }
+                return this->store_texture(path_as_string, temp_texture, anti_aliasing);
             }
             else
                 throw exceptions::TextureNotFound(texture_path);
@@ -55,10 +134,265 @@ namespace obe::engine
         return get_texture(path, default_anti_aliasing);
     }
 
+    graphics::TexturePart ResourceManager::get_texture_part(
+        const system::Path& path, bool anti_aliasing)
+    {
+        const std::string path_as_string = path.to_string();
+        if (!use_texture_atlas || utils::string::ends_with(path_as_string, ".svg"))
+        {
+            return this->get_texture(path, anti_aliasing).make_texture_part();
+        }
+        std::unique_ptr<graphics::TextureAtlas>& atlas
+            = (anti_aliasing) ? m_anti_aliased_atlas : m_atlas;
+        if (!atlas)
+        {
+            atlas = std::make_unique<graphics::TextureAtlas>(atlas_page_size, anti_aliasing);
+        }
+        if (const graphics::TexturePart* part = atlas->find(path_as_string))
+        {
+            return *part;
+        }
+        const TexturePair& cached = m_textures[path_as_string];
+        if ((anti_aliasing && cached.second) || (!anti_aliasing && cached.first))
+        {
+            return this->get_texture(path, anti_aliasing).make_texture_part();
+        }
+
+        const system::FindResult search_result = path.find();
+        const std::string& texture_path = search_result.path();
+        debug::Log->debug("[ResourceManager] Loading <Texture> {} from {} (atlas)",
+            path_as_string, texture_path);
+        sf::Image image;
+        if (!image.loadFromFile(texture_path))
+        {
+            throw exceptions::TextureNotFound(texture_path);
+        }
+        const sf::Vector2u image_size = image.getSize();
+        if (image_size.x <= atlas_max_image_size && image_size.y <= atlas_max_image_size)
+        {
+            if (const graphics::TexturePart* part = atlas->insert(path_as_string, image))
+            {
+                return *part;
+            }
+        }
+        // Too big for the atlas, the already decoded image is uploaded as-is
+        graphics::Texture texture = graphics::Texture::make_shared_texture();
+        texture.load_from_image(image);
+        return this->store_texture(path_as_string, texture, anti_aliasing).make_texture_part();
+    }
+
+    graphics::TexturePart ResourceManager::get_texture_part(const system::Path& path)
+    {
+        return get_texture_part(path, default_anti_aliasing);
+    }
+
+    graphics::TextureAtlasStats ResourceManager::get_atlas_stats() const
+    {
+        graphics::TextureAtlasStats stats;
+        for (const auto* atlas : { m_atlas.get(), m_anti_aliased_atlas.get() })
+        {
+            if (atlas)
+            {
+                const graphics::TextureAtlasStats atlas_stats = atlas->get_stats();
+                stats.pages += atlas_stats.pages;
+                stats.images += atlas_stats.images;
+                stats.used_pixels += atlas_stats.used_pixels;
+                stats.total_pixels += atlas_stats.total_pixels;
+            }
+        }
+        if (stats.total_pixels)
+        {
+            stats.occupancy
+                = static_cast<double>(stats.used_pixels) / static_cast<double>(stats.total_pixels);
+        }
+        return stats;
+    }
+
+    const graphics::Texture& ResourceManager::load_texture_async(
+        const system::Path& path, bool anti_aliasing, const TextureLoadedCallback& callback)
+    {
+        const std::string path_as_string = path.to_string();
+        TexturePair& cached = m_textures[path_as_string];
+        if (const std::unique_ptr<graphics::Texture>& slot
+            = (anti_aliasing) ? cached.second : cached.first)
+        {
+            const auto pending = this->find_pending_texture(path_as_string, anti_aliasing);
+            if (pending != m_pending_textures.end())
+            {
+                if (callback)
+                {
+                    pending->callbacks.push_back(callback);
+                }
+            }
+            else if (callback)
+            {
+                callback(*slot);
+            }
+            return *slot;
+        }
+
+        const system::FindResult search_result = path.find();
+        const std::string texture_path = search_result.path();
+        if (!search_result.success())
+        {
+            throw exceptions::TextureNotFound(path_as_string);
+        }
+        if (utils::string::ends_with(texture_path, ".svg"))
+        {
+            // Vector textures are rasterized on demand and can't be decoded in advance
+            const graphics::Texture& texture = this->get_texture(path, anti_aliasing);
+            if (callback)
+            {
+                callback(texture);
+            }
+            return texture;
+        }
+
+        debug::Log->debug("[ResourceManager] Loading <Texture> {} from {} in background",
+            path_as_string, texture_path);
+        sf::Image placeholder;
+        placeholder.create(1, 1, placeholder_color);
+        graphics::Texture texture = graphics::Texture::make_shared_texture();
+        texture.load_from_image(placeholder);
+        const graphics::Texture& stored_texture
+            = this->store_texture(path_as_string, texture, anti_aliasing);
+
+        PendingTexture pending { path_as_string, texture_path, anti_aliasing,
+            this->get_loader_pool().submit([texture_path]() -> std::optional<sf::Image> {
+                sf::Image image;
+                if (!image.loadFromFile(texture_path))
+                {
+                    return std::nullopt;
+                }
+                return image;
+            }),
+            {} };
+        if (callback)
+        {
+            pending.callbacks.push_back(callback);
+        }
+        m_pending_textures.push_back(std::move(pending));
+        return stored_texture;
+    }
+
+    const graphics::Texture& ResourceManager::load_texture_async(
+        const system::Path& path, const TextureLoadedCallback& callback)
+    {
+        return load_texture_async(path, default_anti_aliasing, callback);
+    }
+
+    std::shared_ptr<graphics::Font> ResourceManager::load_font_async(
+        const std::string& path, const FontLoadedCallback& callback)
+    {
+        if (const auto font = m_fonts.find(path); font != m_fonts.end())
+        {
+            const auto pending = this->find_pending_font(path);
+            if (pending != m_pending_fonts.end())
+            {
+                if (callback)
+                {
+                    pending->callbacks.push_back(callback);
+                }
+            }
+            else if (callback)
+            {
+                callback(font->second);
+            }
+            return font->second;
+        }
+
+        const system::FindResult search_result
+            = system::Path(path).find(system::PathType::File);
+        if (!search_result.success())
+        {
+            throw exceptions::FontNotFound(path, system::MountablePath::string_paths());
+        }
+        const std::string font_path = search_result.path();
+        debug::Log->debug(
+            "[ResourceManager] Loading <Font> {} from {} in background", path, font_path);
+        std::shared_ptr<graphics::Font> font = std::make_shared<graphics::Font>();
+        m_fonts[path] = font;
+
+        PendingFont pending { path,
+            this->get_loader_pool().submit([font_path]() -> std::unique_ptr<graphics::Font> {
+                auto loaded_font = std::make_unique<graphics::Font>();
+                if (!loaded_font->load_from_file(font_path))
+                {
+                    return nullptr;
+                }
+                return loaded_font;
+            }),
+            {} };
+        if (callback)
+        {
+            pending.callbacks.push_back(callback);
+        }
+        m_pending_fonts.push_back(std::move(pending));
+        return font;
+    }
+
+    void ResourceManager::update()
+    {
+        const auto is_ready = [](const auto& future) {
+            return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        };
+        // Ready loads are moved out first as callbacks are allowed to start new loads
+        std::vector<PendingTexture> ready_textures;
+        for (auto pending = m_pending_textures.begin(); pending != m_pending_textures.end();)
+        {
+            if (async_uploads_per_update && ready_textures.size() >= async_uploads_per_update)
+            {
+                break;
+            }
+            if (is_ready(pending->image))
+            {
+                ready_textures.push_back(std::move(*pending));
+                pending = m_pending_textures.erase(pending);
+            }
+            else
+            {
+                ++pending;
+            }
+        }
+        std::vector<PendingFont> ready_fonts;
+        for (auto pending = m_pending_fonts.begin(); pending != m_pending_fonts.end();)
+        {
+            if (is_ready(pending->font))
+            {
+                ready_fonts.push_back(std::move(*pending));
+                pending = m_pending_fonts.erase(pending);
+            }
+            else
+            {
+                ++pending;
+            }
+        }
+
+        for (PendingTexture& pending : ready_textures)
+        {
+            this->finish_texture_loading(pending);
+        }
+        for (PendingFont& pending : ready_fonts)
+        {
+            this->finish_font_loading(pending);
+        }
+    }
+
+    std::size_t ResourceManager::get_pending_loads() const
+    {
+        return m_pending_textures.size() + m_pending_fonts.size();
+    }
+
     void ResourceManager::clean()
     {
         for (auto& texture_pair : m_textures)
         {
+            if (this->find_pending_texture(texture_pair.first, false) != m_pending_textures.end()
+                || this->find_pending_texture(texture_pair.first, true)
+                    != m_pending_textures.end())
+            {
+                continue;
+            }
             if (texture_pair.second.first && texture_pair.second.first->use_count() == 1)
             {
                 texture_pair.second.first.reset();
@@ -77,6 +411,12 @@ namespace obe::engine
 
     std::shared_ptr<graphics::Font> ResourceManager::get_font(const std::string& path)
     {
+        if (const auto pending = this->find_pending_font(path); pending != m_pending_fonts.end())
+        {
+            PendingFont loading = std::move(*pending);
+            m_pending_fonts.erase(pending);
+            this->finish_font_loading(loading);
+        }
         if (!m_fonts.contains(path))
         {
             const system::FindResult search_result
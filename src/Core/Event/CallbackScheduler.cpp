@@ -1,8 +1,11 @@
+#include <algorithm>
+#include <limits>
+
 #include <Event/CallbackScheduler.hpp>
 
 namespace obe::event
 {
-    void CallbackScheduler::execute()
+    void CallbackScheduler::execute(time::TimeUnit now)
     {
         if (!m_repeat)
         {
@@ -16,13 +19,23 @@ namespace obe::event
             }
             else
             {
-                m_start = time::epoch();
+                m_start = now;
                 m_current_times++;
             }
         }
         m_callback();
     }
 
+    time::TimeUnit CallbackScheduler::get_deadline() const
+    {
+        time::TimeUnit deadline = std::numeric_limits<time::TimeUnit>::infinity();
+        if (m_wait)
+            deadline = m_start + m_after;
+        if (m_repeat)
+            deadline = std::min(deadline, m_start + m_every);
+        return deadline;
+    }
+
     CallbackScheduler& CallbackScheduler::after(double amount)
     {
         m_after = amount;
@@ -47,7 +60,7 @@ namespace obe::event
     {
         m_callback = callback;
         m_state = CallbackSchedulerState::Ready;
-        m_start = time::epoch();
+        m_start = time::now();
     }
 
     void CallbackScheduler::stop()
@@ -13,16 +13,12 @@ namespace obe::event
         m_on_remove_listener = std::move(callback);
     }
 
-    void EventBase::collect_garbage()
+    void EventBase::notify_removal(const std::optional<std::string>& removed_id) const
     {
-        debug::Log->trace(
-            "EventListeners Garbage Collection for Event {} [External]", m_identifier);
-        for (const std::string& listener_id : m_garbage_collector)
+        if (removed_id && m_on_remove_listener)
         {
-            debug::Log->trace("  - Garbage Collecting listener {}", listener_id);
-            m_listeners.erase(listener_id);
+            m_on_remove_listener(ListenerChangeState::Removed, *removed_id);
         }
-        m_garbage_collector.clear();
     }
 
     EventBase::EventBase(
@@ -50,27 +46,61 @@ namespace obe::event
         return m_identifier;
     }
 
-    void EventBase::add_external_listener(
+    void EventBase::flush()
+    {
+    }
+
+    void EventBase::set_coalescing(bool coalescing)
+    {
+        m_coalescing = coalescing;
+    }
+
+    bool EventBase::is_coalescing() const
+    {
+        return m_coalescing;
+    }
+
+    void EventBase::set_batched(bool batched)
+    {
+        m_batched = batched;
+    }
+
+    bool EventBase::is_batched() const
+    {
+        return m_batched;
+    }
+
+    std::size_t EventBase::get_queued_amount() const
+    {
+        return 0;
+    }
+
+    std::size_t EventBase::get_listeners_amount() const
+    {
+        return m_listeners.size();
+    }
+
+    ListenerHandle EventBase::add_external_listener(
         const std::string& id, const ExternalEventListener& listener)
     {
         debug::Log->trace("<Event> Adding new listener '{}' to Event '{}'", id, m_identifier);
-        m_listeners.emplace(id, listener);
-        if (m_on_add_listener)
+        const std::size_t listeners_amount = m_listeners.size();
+        const ListenerHandle handle = m_listeners.add(id, listener);
+        if (m_on_add_listener && m_listeners.size() != listeners_amount)
         {
             m_on_add_listener(ListenerChangeState::Added, id);
         }
+        return handle;
     }
 
     void EventBase::remove_external_listener(const std::string& id)
     {
         debug::Log->trace("<Event> Removing listener '{}' from Event '{}'", id, m_identifier);
-        if (m_garbage_lock)
-            m_garbage_collector.push_back(id);
-        else
-            m_listeners.erase(id);
-        if (m_on_remove_listener)
-        {
-            m_on_remove_listener(ListenerChangeState::Removed, id);
-        }
+        this->notify_removal(m_listeners.remove(id));
+    }
+
+    void EventBase::remove_external_listener(ListenerHandle handle)
+    {
+        this->notify_removal(m_listeners.remove(handle));
     }
 } // namespace obe::event
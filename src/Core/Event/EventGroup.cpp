@@ -90,6 +90,26 @@ namespace obe::event
         return m_joinable;
     }
 
+    void EventGroup::set_queued(bool queued)
+    {
+        if (m_queued && !queued)
+            this->flush();
+        m_queued = queued;
+    }
+
+    bool EventGroup::is_queued() const
+    {
+        return m_queued;
+    }
+
+    void EventGroup::flush()
+    {
+        for (const auto& [event_name, event] : m_events)
+        {
+            event->flush();
+        }
+    }
+
     std::vector<std::string> EventGroup::get_events_names() const
     {
         std::vector<std::string> names;
@@ -1,11 +1,46 @@
+#include <stdexcept>
+#include <string>
 #include <utility>
 
 #include <Event/EventListener.hpp>
 
 namespace obe::event
 {
+    namespace
+    {
+        // Error handler shared by all Lua listeners, adds the traceback to the error
+        int append_traceback(lua_State* state)
+        {
+            const char* message = luaL_tolstring(state, 1, nullptr);
+            luaL_traceback(state, state, message, 1);
+            return 1;
+        }
+    }
+
     LuaEventListener::LuaEventListener(sol::protected_function callback)
         : m_callback(std::move(callback))
     {
     }
+
+    void LuaEventListener::call(const sol::reference& payload) const
+    {
+        lua_State* state = m_callback.lua_state();
+        luaL_checkstack(state, 3, "not enough stack space to call an event listener");
+        const int top = lua_gettop(state);
+        lua_pushcfunction(state, &append_traceback);
+        m_callback.push(state);
+        payload.push(state);
+        if (lua_pcall(state, 1, 0, top + 1) != LUA_OK)
+        {
+            std::string message = luaL_tolstring(state, -1, nullptr);
+            lua_settop(state, top);
+            throw script::exceptions::LuaExecutionError(std::runtime_error(message));
+        }
+        lua_settop(state, top);
+    }
+
+    lua_State* LuaEventListener::get_lua_state() const
+    {
+        return m_callback.lua_state();
+    }
 }
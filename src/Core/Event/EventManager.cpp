@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <Event/EventManager.hpp>
 
 namespace obe::event
@@ -8,25 +10,69 @@ namespace obe::event
         m_chrono.start();
     }
 
+    bool EventManager::has_later_deadline(const std::unique_ptr<CallbackScheduler>& first,
+        const std::unique_ptr<CallbackScheduler>& second)
+    {
+        return first->m_deadline > second->m_deadline;
+    }
+
+    void EventManager::push_scheduler(std::unique_ptr<CallbackScheduler> scheduler)
+    {
+        scheduler->m_deadline = scheduler->get_deadline();
+        m_schedulers.push_back(std::move(scheduler));
+        std::push_heap(m_schedulers.begin(), m_schedulers.end(), has_later_deadline);
+    }
+
     void EventManager::update()
     {
         debug::Log->trace("<EventManager> Updating EventManager");
-        for (const auto& scheduler : m_schedulers)
+        // Callbacks may create new schedulers, they wait for the next update
+        std::vector<std::unique_ptr<CallbackScheduler>> pending;
+        std::swap(pending, m_pending_schedulers);
+        for (std::unique_ptr<CallbackScheduler>& scheduler : pending)
         {
             if (scheduler->m_state == CallbackSchedulerState::Ready)
-            {
-                const time::TimeUnit elapsed = time::epoch() - scheduler->m_start;
-                if ((scheduler->m_wait && elapsed >= scheduler->m_after)
-                    || (scheduler->m_repeat && elapsed >= scheduler->m_every))
-                {
-                    scheduler->execute();
-                }
-            }
+                this->push_scheduler(std::move(scheduler));
+            else if (scheduler->m_state == CallbackSchedulerState::Standby)
+                m_pending_schedulers.push_back(std::move(scheduler));
+        }
+
+        const time::TimeUnit now = time::now();
+        while (!m_schedulers.empty())
+        {
+            CallbackScheduler& next = *m_schedulers.front();
+            if (next.m_state != CallbackSchedulerState::Done && next.m_deadline > now)
+                break;
+            std::pop_heap(m_schedulers.begin(), m_schedulers.end(), has_later_deadline);
+            std::unique_ptr<CallbackScheduler> scheduler = std::move(m_schedulers.back());
+            m_schedulers.pop_back();
+            if (scheduler->m_state == CallbackSchedulerState::Done)
+                continue;
+            // Repeating schedulers are pushed back once the heap is drained so a zero
+            // interval fires once per update
+            scheduler->execute(now);
+            if (scheduler->m_state == CallbackSchedulerState::Ready)
+                m_repeating_schedulers.push_back(std::move(scheduler));
+        }
+        for (std::unique_ptr<CallbackScheduler>& scheduler : m_repeating_schedulers)
+        {
+            this->push_scheduler(std::move(scheduler));
+        }
+        m_repeating_schedulers.clear();
+    }
+
+    void EventManager::flush() const
+    {
+        std::vector<EventNamespace*> namespaces;
+        namespaces.reserve(m_namespaces.size());
+        for (const auto& [namespace_name, event_namespace] : m_namespaces)
+        {
+            namespaces.push_back(event_namespace.get());
+        }
+        for (const EventNamespace* event_namespace : namespaces)
+        {
+            event_namespace->flush();
         }
-        m_schedulers.erase(
-            std::remove_if(m_schedulers.begin(), m_schedulers.end(),
-                [](auto& scheduler) { return scheduler->m_state == CallbackSchedulerState::Done; }),
-            m_schedulers.end());
     }
 
     void EventManager::clear()
@@ -37,6 +83,8 @@ namespace obe::event
         m_chrono.reset();
         m_chrono.start();
         m_schedulers.clear();
+        m_pending_schedulers.clear();
+        m_repeating_schedulers.clear();
     }
 
     EventNamespace& EventManager::create_namespace(const std::string& event_namespace)
@@ -90,7 +138,7 @@ namespace obe::event
 
     CallbackScheduler& EventManager::schedule()
     {
-        m_schedulers.push_back(std::make_unique<CallbackScheduler>());
-        return *m_schedulers.back();
+        m_pending_schedulers.push_back(std::make_unique<CallbackScheduler>());
+        return *m_pending_schedulers.back();
     }
 } // namespace obe::event
@@ -138,4 +138,20 @@ namespace obe::event
     {
         return m_name;
     }
+
+    void EventNamespace::flush() const
+    {
+        // Listeners may create or remove EventGroups while being called
+        std::vector<EventGroupPtr> queued_groups;
+        for (const auto& [group_name, group] : m_groups)
+        {
+            EventGroupPtr queued_group = group.lock();
+            if (queued_group && queued_group->is_queued())
+                queued_groups.push_back(std::move(queued_group));
+        }
+        for (const EventGroupPtr& group : queued_groups)
+        {
+            group->flush();
+        }
+    }
 }
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <tuple>
+
+#include <Graphics/RenderQueue.hpp>
+#include <Graphics/Renderable.hpp>
+
+namespace obe::graphics
+{
+    bool RenderQueue::draw_order(const Renderable* renderable1, const Renderable* renderable2)
+    {
+        if (renderable1->get_layer() == renderable2->get_layer())
+        {
+            return renderable1->get_sublayer() > renderable2->get_sublayer();
+        }
+        return renderable1->get_layer() > renderable2->get_layer();
+    }
+
+    void RenderQueue::insert_sorted(Renderable& renderable)
+    {
+        if (m_needs_sort)
+        {
+            m_renderables.push_back(&renderable);
+            return;
+        }
+        // upper_bound keeps insertion order between Renderables sharing the same layer / sublayer
+        const auto position = std::upper_bound(
+            m_renderables.begin(), m_renderables.end(), &renderable, &RenderQueue::draw_order);
+        m_renderables.insert(position, &renderable);
+    }
+
+    void RenderQueue::erase(const Renderable& renderable)
+    {
+        auto begin = m_renderables.begin();
+        auto end = m_renderables.end();
+        if (!m_needs_sort)
+        {
+            std::tie(begin, end)
+                = std::equal_range(begin, end, &renderable, &RenderQueue::draw_order);
+        }
+        const auto it = std::find(begin, end, &renderable);
+        if (it != end)
+        {
+            m_renderables.erase(it);
+        }
+    }
+
+    RenderQueue::~RenderQueue()
+    {
+        this->clear();
+    }
+
+    void RenderQueue::add(Renderable& renderable)
+    {
+        if (renderable.m_render_queue == this)
+        {
+            return;
+        }
+        if (renderable.m_render_queue)
+        {
+            renderable.m_render_queue->remove(renderable);
+        }
+        this->insert_sorted(renderable);
+        renderable.m_render_queue = this;
+    }
+
+    void RenderQueue::remove(Renderable& renderable)
+    {
+        if (renderable.m_render_queue != this)
+        {
+            return;
+        }
+        this->erase(renderable);
+        renderable.m_render_queue = nullptr;
+    }
+
+    void RenderQueue::clear()
+    {
+        for (Renderable* renderable : m_renderables)
+        {
+            renderable->m_render_queue = nullptr;
+        }
+        m_renderables.clear();
+        m_needs_sort = false;
+    }
+
+    void RenderQueue::invalidate()
+    {
+        m_needs_sort = true;
+    }
+
+    bool RenderQueue::contains(const Renderable& renderable) const
+    {
+        return renderable.m_render_queue == this;
+    }
+
+    std::size_t RenderQueue::size() const
+    {
+        return m_renderables.size();
+    }
+
+    const std::vector<Renderable*>& RenderQueue::get_renderables()
+    {
+        if (m_needs_sort)
+        {
+            std::stable_sort(m_renderables.begin(), m_renderables.end(), &RenderQueue::draw_order);
+            m_needs_sort = false;
+        }
+        return m_renderables;
+    }
+} // namespace obe::graphics
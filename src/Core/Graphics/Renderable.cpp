@@ -1,4 +1,6 @@
+#include <Graphics/RenderQueue.hpp>
 #include <Graphics/Renderable.hpp>
+#include <Graphics/SpriteBatch.hpp>
 
 namespace obe::graphics
 {
@@ -8,6 +10,30 @@ namespace obe::graphics
     {
     }
 
+    Renderable::Renderable(const Renderable& other)
+        : m_layer(other.m_layer)
+        , m_sublayer(other.m_sublayer)
+        , m_visible(other.m_visible)
+    {
+    }
+
+    Renderable& Renderable::operator=(const Renderable& other)
+    {
+        // RenderQueue membership is not copied, only the draw order is
+        this->set_layer(other.m_layer);
+        this->set_sublayer(other.m_sublayer);
+        m_visible = other.m_visible;
+        return *this;
+    }
+
+    Renderable::~Renderable()
+    {
+        if (m_render_queue)
+        {
+            m_render_queue->remove(*this);
+        }
+    }
+
     int32_t Renderable::get_layer() const
     {
         return m_layer;
@@ -23,14 +49,45 @@ namespace obe::graphics
         return m_visible;
     }
 
+    bool Renderable::is_culled() const
+    {
+        return m_culled;
+    }
+
     void Renderable::set_layer(int32_t layer)
     {
-        m_layer = layer;
+        if (layer == m_layer)
+        {
+            return;
+        }
+        if (m_render_queue)
+        {
+            m_render_queue->erase(*this);
+            m_layer = layer;
+            m_render_queue->insert_sorted(*this);
+        }
+        else
+        {
+            m_layer = layer;
+        }
     }
 
     void Renderable::set_sublayer(int32_t sublayer)
     {
-        m_sublayer = sublayer;
+        if (sublayer == m_sublayer)
+        {
+            return;
+        }
+        if (m_render_queue)
+        {
+            m_render_queue->erase(*this);
+            m_sublayer = sublayer;
+            m_render_queue->insert_sorted(*this);
+        }
+        else
+        {
+            m_sublayer = sublayer;
+        }
     }
 
     void Renderable::set_visible(bool visible)
@@ -47,4 +104,11 @@ namespace obe::graphics
     {
         m_visible = false;
     }
+
+    void Renderable::draw_batched(
+        RenderTarget& surface, const scene::Camera& camera, SpriteBatch& batch)
+    {
+        batch.flush(surface);
+        this->draw(surface, camera);
+    }
 }
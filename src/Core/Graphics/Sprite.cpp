@@ -2,6 +2,8 @@
 #include <Graphics/DrawUtils.hpp>
 #include <Graphics/Exceptions.hpp>
 #include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteBatch.hpp>
+#include <Graphics/SpriteCuller.hpp>
 #include <System/Path.hpp>
 #include <System/Window.hpp>
 #include <Utils/MathUtils.hpp>
@@ -74,15 +76,25 @@ namespace obe::graphics
         m_position_transformer = PositionTransformer("Camera", "Camera");
     }
 
+    Sprite::~Sprite()
+    {
+        if (m_culler)
+        {
+            m_culler->remove(*this);
+        }
+    }
+
     void Sprite::use_texture_size()
     {
-        const transform::UnitVector texture_size = this->get_texture().get_size();
+        const transform::UnitVector texture_size
+            = m_atlas_region_size.value_or(this->get_texture().get_size());
         const transform::UnitVector initial_sprite_size(
             texture_size.x, texture_size.y, transform::Units::ScenePixels);
         this->set_size(initial_sprite_size);
     }
 
-    void Sprite::draw(RenderTarget& surface, const scene::Camera& camera)
+    std::array<sf::Vertex, 4> Sprite::compute_vertices(
+        RenderTarget& surface, const scene::Camera& camera)
     {
         const transform::UnitVector pixel_camera
             = camera.get_position().to<transform::Units::ScenePixels>();
@@ -119,6 +131,12 @@ namespace obe::graphics
             refresh_vector_texture(surface_size, vertices);
         }
 
+        return vertices;
+    }
+
+    void Sprite::draw(RenderTarget& surface, const scene::Camera& camera)
+    {
+        std::array<sf::Vertex, 4> vertices = this->compute_vertices(surface, camera);
         m_sprite.setVertices(vertices);
 
         if (m_shader)
@@ -132,6 +150,42 @@ namespace obe::graphics
         }
     }
 
+    void Sprite::draw_batched(
+        RenderTarget& surface, const scene::Camera& camera, SpriteBatch& batch)
+    {
+        std::array<sf::Vertex, 4> vertices = this->compute_vertices(surface, camera);
+        m_sprite.setVertices(vertices);
+
+        if (const sf::Texture* texture = m_sprite.getTexture())
+        {
+            // Same quad as the one sfe::ComplexSprite would draw, baked in scene pixels
+            const sf::Transform& transform = m_sprite.getTransform();
+            const sf::IntRect& texture_rect = m_sprite.getTextureRect();
+            const float left = static_cast<float>(texture_rect.left);
+            const float top = static_cast<float>(texture_rect.top);
+            const float right = left + static_cast<float>(texture_rect.width);
+            const float bottom = top + static_cast<float>(texture_rect.height);
+            const std::array<sf::Vector2f, 4> tex_coords = { sf::Vector2f(left, top),
+                sf::Vector2f(left, bottom), sf::Vector2f(right, top),
+                sf::Vector2f(right, bottom) };
+            for (std::size_t i = 0; i < vertices.size(); i++)
+            {
+                vertices[i].position = transform.transformPoint(vertices[i].position);
+                vertices[i].color = m_sprite.getColor();
+                vertices[i].texCoords = tex_coords[i];
+            }
+            sf::RenderStates states(texture);
+            states.shader = m_shader;
+            batch.add(surface, vertices, states);
+        }
+
+        if (m_selected)
+        {
+            batch.flush(surface);
+            this->draw_handle(surface, camera);
+        }
+    }
+
     void Sprite::attach_resource_manager(engine::ResourceManager& resources)
     {
         this->set_anti_aliasing(resources.default_anti_aliasing);
@@ -145,13 +199,10 @@ namespace obe::graphics
 
     void Sprite::flip(bool horizontally, bool vertically)
     {
-        if (horizontally || vertically)
+        // Atlas pages are shared, the negative texture rect already flips the region
+        if (!m_atlas_region_size)
         {
-            m_texture.set_repeated(true);
-        }
-        else
-        {
-            m_texture.set_repeated(false);
+            m_texture.set_repeated(horizontally || vertically);
         }
         m_horizontal_flip = horizontally;
         m_vertical_flip = vertically;
@@ -170,17 +221,26 @@ namespace obe::graphics
         if (!path.empty() and path != m_path)
         {
             m_path = path;
+            m_atlas_region_size.reset();
             if (m_resources)
             {
-                m_texture = m_resources->get_texture(system::Path(path), m_antiAliasing);
-            }
-            else
-            {
-                m_texture.reset();
-                m_texture.load_from_file(system::Path(path).find());
-                m_texture.set_anti_aliasing(m_antiAliasing);
+                const TexturePart texture_part
+                    = m_resources->get_texture_part(system::Path(path), m_antiAliasing);
+                m_texture = texture_part.get_texture();
+                const transform::AABB& rect = texture_part.get_texture_rect();
+                m_sprite.setTexture(m_texture);
+                m_sprite.setTextureRect(
+                    sf::IntRect(rect.x(), rect.y(), rect.width(), rect.height()));
+                if (rect.get_size() != m_texture.get_size())
+                {
+                    m_atlas_region_size = rect.get_size();
+                }
+                return;
             }
 
+            m_texture.reset();
+            m_texture.load_from_file(system::Path(path).find());
+            m_texture.set_anti_aliasing(m_antiAliasing);
             m_sprite.setTexture(m_texture);
             m_sprite.setTextureRect(
                 sf::IntRect(0, 0, m_texture.get_size().x, m_texture.get_size().y));
@@ -194,6 +254,7 @@ namespace obe::graphics
     void Sprite::set_texture(const Texture& texture)
     {
         // m_texture = std::shared_ptr<Texture>(std::shared_ptr<Texture>(), texture);
+        m_atlas_region_size.reset();
         m_sprite.setTexture(texture);
         const transform::UnitVector texture_size = texture.get_size();
         this->set_texture_rect(0, 0, texture_size.x, texture_size.y);
@@ -217,6 +278,10 @@ namespace obe::graphics
         this->set_texture(texture.get_texture());
         const transform::AABB& rect = texture.get_texture_rect();
         this->set_texture_rect(rect.x(), rect.y(), rect.width(), rect.height());
+        if (rect.get_size() != texture.get_texture().get_size())
+        {
+            m_atlas_region_size = rect.get_size();
+        }
     }
 
     const graphics::Texture& Sprite::get_texture() const
@@ -0,0 +1,65 @@
+#include <Graphics/SpriteBatch.hpp>
+
+namespace obe::graphics
+{
+    bool SpriteBatch::can_merge(const sf::RenderStates& states) const
+    {
+        return states.texture == m_states.texture && states.shader == m_states.shader
+            && states.blendMode == m_states.blendMode;
+    }
+
+    void SpriteBatch::add(
+        RenderTarget& target, const std::array<sf::Vertex, 4>& quad, const sf::RenderStates& states)
+    {
+        if (states.texture != m_last_texture)
+        {
+            m_stats.texture_switches++;
+            m_last_texture = states.texture;
+        }
+        if (!m_vertices.empty() && !this->can_merge(states))
+        {
+            this->flush(target);
+        }
+        if (m_vertices.empty())
+        {
+            m_states.texture = states.texture;
+            m_states.shader = states.shader;
+            m_states.blendMode = states.blendMode;
+        }
+        // Triangle strip quad split into two triangles so quads can be chained
+        m_vertices.push_back(quad[0]);
+        m_vertices.push_back(quad[1]);
+        m_vertices.push_back(quad[2]);
+        m_vertices.push_back(quad[2]);
+        m_vertices.push_back(quad[1]);
+        m_vertices.push_back(quad[3]);
+        m_stats.sprites++;
+    }
+
+    void SpriteBatch::flush(RenderTarget& target)
+    {
+        if (m_vertices.empty())
+        {
+            return;
+        }
+        target.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, m_states);
+        m_vertices.clear();
+        m_stats.draw_calls++;
+    }
+
+    std::size_t SpriteBatch::pending() const
+    {
+        return m_vertices.size() / 6;
+    }
+
+    void SpriteBatch::reset_stats()
+    {
+        m_stats = SpriteBatchStats {};
+        m_last_texture = nullptr;
+    }
+
+    SpriteBatchStats SpriteBatch::get_stats() const
+    {
+        return m_stats;
+    }
+} // namespace obe::graphics
@@ -0,0 +1,424 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteCuller.hpp>
+#include <Scene/Camera.hpp>
+
+namespace obe::graphics
+{
+    namespace
+    {
+        // Sprites spanning more cells than this are tested every frame instead
+        constexpr int64_t MaxCellsPerSprite = 256;
+
+        bool same_raw_vector(const transform::UnitVector& vec1, const transform::UnitVector& vec2)
+        {
+            return vec1.x == vec2.x && vec1.y == vec2.y && vec1.unit == vec2.unit;
+        }
+
+        int64_t cell_key(int32_t x, int32_t y)
+        {
+            return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+        }
+
+        int32_t to_cell(double position, double cell_size)
+        {
+            return static_cast<int32_t>(std::floor(position / cell_size));
+        }
+
+        /**
+         * \brief Computes the range of world coordinates that a CoordinateTransformer maps
+         *        inside the Camera
+         * \return false if the transformer is unknown and the range can't be computed
+         */
+        bool get_visible_range(const std::string& transformer, double camera_position,
+            double camera_size, int32_t layer, double& min, double& max)
+        {
+            if (transformer == "Camera")
+            {
+                min = camera_position;
+            }
+            else if (transformer == "Parallax" && layer != 0)
+            {
+                min = camera_position / static_cast<double>(layer);
+            }
+            else if (transformer == "Position")
+            {
+                min = 0;
+            }
+            else
+            {
+                return false;
+            }
+            max = min + camera_size;
+            return true;
+        }
+
+        bool is_known_transformer(const std::string& transformer, int32_t layer)
+        {
+            double min, max;
+            return get_visible_range(transformer, 0, 0, layer, min, max);
+        }
+    }
+
+    bool SpriteCuller::has_changed(const Entry& entry) const
+    {
+        const Sprite& sprite = *entry.sprite;
+        return !same_raw_vector(entry.position, sprite.m_position)
+            || !same_raw_vector(entry.size, sprite.m_size) || entry.angle != sprite.m_angle
+            || entry.layer != sprite.m_layer
+            || entry.x_transformer != sprite.m_position_transformer.m_x_transformer_name
+            || entry.y_transformer != sprite.m_position_transformer.m_y_transformer_name;
+    }
+
+    void SpriteCuller::refresh(std::size_t index, bool force)
+    {
+        Entry& entry = m_entries[index];
+        if (!force && !this->has_changed(entry))
+        {
+            return;
+        }
+        this->unlink(index);
+
+        const Sprite& sprite = *entry.sprite;
+        entry.position = sprite.m_position;
+        entry.size = sprite.m_size;
+        entry.angle = sprite.m_angle;
+        entry.layer = sprite.m_layer;
+        entry.x_transformer = sprite.m_position_transformer.m_x_transformer_name;
+        entry.y_transformer = sprite.m_position_transformer.m_y_transformer_name;
+        entry.group = this->find_group(entry);
+
+        const transform::Units unit = entry.position.unit;
+        entry.cullable = m_groups[entry.group].cullable
+            && (unit == transform::Units::SceneUnits || unit == transform::Units::ScenePixels);
+        if (entry.cullable)
+        {
+            entry.bounds.min_x = entry.bounds.min_y = std::numeric_limits<double>::max();
+            entry.bounds.max_x = entry.bounds.max_y = std::numeric_limits<double>::lowest();
+            for (const transform::Referential& corner :
+                { transform::Referential::TopLeft, transform::Referential::TopRight,
+                    transform::Referential::BottomLeft, transform::Referential::BottomRight })
+            {
+                const transform::UnitVector point
+                    = sprite.Rect::get_position(corner).to<transform::Units::SceneUnits>();
+                entry.bounds.min_x = std::min(entry.bounds.min_x, point.x);
+                entry.bounds.min_y = std::min(entry.bounds.min_y, point.y);
+                entry.bounds.max_x = std::max(entry.bounds.max_x, point.x);
+                entry.bounds.max_y = std::max(entry.bounds.max_y, point.y);
+            }
+        }
+        this->link(index);
+        m_stats.reindexed++;
+    }
+
+    void SpriteCuller::link(std::size_t index)
+    {
+        Entry& entry = m_entries[index];
+        if (!entry.cullable)
+        {
+            return;
+        }
+        Group& group = m_groups[entry.group];
+        const Bounds& bounds = entry.bounds;
+        const double cells_x = std::floor(bounds.max_x / m_cell_size)
+            - std::floor(bounds.min_x / m_cell_size) + 1;
+        const double cells_y = std::floor(bounds.max_y / m_cell_size)
+            - std::floor(bounds.min_y / m_cell_size) + 1;
+        // Negated comparison so that NaN bounds also end up in the oversized list
+        if (!(cells_x * cells_y <= static_cast<double>(MaxCellsPerSprite)))
+        {
+            entry.oversized = true;
+            group.oversized.push_back(index);
+            return;
+        }
+        entry.oversized = false;
+        entry.cells = CellRange { to_cell(bounds.min_x, m_cell_size),
+            to_cell(bounds.min_y, m_cell_size), to_cell(bounds.max_x, m_cell_size),
+            to_cell(bounds.max_y, m_cell_size) };
+        for (int32_t x = entry.cells.min_x; x <= entry.cells.max_x; x++)
+        {
+            for (int32_t y = entry.cells.min_y; y <= entry.cells.max_y; y++)
+            {
+                group.cells[cell_key(x, y)].push_back(index);
+            }
+        }
+    }
+
+    void SpriteCuller::unlink(std::size_t index)
+    {
+        Entry& entry = m_entries[index];
+        if (!entry.cullable)
+        {
+            return;
+        }
+        const auto swap_and_pop = [index](std::vector<std::size_t>& indexes) {
+            const auto it = std::find(indexes.begin(), indexes.end(), index);
+            if (it != indexes.end())
+            {
+                *it = indexes.back();
+                indexes.pop_back();
+            }
+        };
+        Group& group = m_groups[entry.group];
+        if (entry.oversized)
+        {
+            swap_and_pop(group.oversized);
+        }
+        else
+        {
+            for (int32_t x = entry.cells.min_x; x <= entry.cells.max_x; x++)
+            {
+                for (int32_t y = entry.cells.min_y; y <= entry.cells.max_y; y++)
+                {
+                    const auto cell = group.cells.find(cell_key(x, y));
+                    if (cell == group.cells.end())
+                    {
+                        continue;
+                    }
+                    swap_and_pop(cell->second);
+                    if (cell->second.empty())
+                    {
+                        group.cells.erase(cell);
+                    }
+                }
+            }
+        }
+        entry.cullable = false;
+        entry.oversized = false;
+        entry.cells = CellRange {};
+    }
+
+    std::size_t SpriteCuller::find_group(const Entry& entry)
+    {
+        const bool parallax
+            = entry.x_transformer == "Parallax" || entry.y_transformer == "Parallax";
+        const int32_t layer = parallax ? entry.layer : 0;
+        for (std::size_t i = 0; i < m_groups.size(); i++)
+        {
+            const Group& group = m_groups[i];
+            if (group.layer == layer && group.x_transformer == entry.x_transformer
+                && group.y_transformer == entry.y_transformer)
+            {
+                return i;
+            }
+        }
+        Group& group = m_groups.emplace_back();
+        group.x_transformer = entry.x_transformer;
+        group.y_transformer = entry.y_transformer;
+        group.layer = layer;
+        group.cullable = is_known_transformer(group.x_transformer, layer)
+            && is_known_transformer(group.y_transformer, layer);
+        return m_groups.size() - 1;
+    }
+
+    void SpriteCuller::test(std::size_t index, const Bounds& view)
+    {
+        Entry& entry = m_entries[index];
+        if (entry.stamp == m_frame)
+        {
+            return;
+        }
+        entry.stamp = m_frame;
+        m_stats.tested++;
+        const Bounds& bounds = entry.bounds;
+        if (bounds.max_x >= view.min_x && bounds.min_x <= view.max_x
+            && bounds.max_y >= view.min_y && bounds.min_y <= view.max_y)
+        {
+            entry.sprite->m_culled = false;
+            m_stats.culled--;
+        }
+    }
+
+    SpriteCuller::~SpriteCuller()
+    {
+        this->clear();
+    }
+
+    void SpriteCuller::add(Sprite& sprite)
+    {
+        if (sprite.m_culler == this)
+        {
+            return;
+        }
+        if (sprite.m_culler)
+        {
+            sprite.m_culler->remove(sprite);
+        }
+        std::size_t index;
+        if (m_free_entries.empty())
+        {
+            index = m_entries.size();
+            m_entries.emplace_back();
+        }
+        else
+        {
+            index = m_free_entries.back();
+            m_free_entries.pop_back();
+            m_entries[index] = Entry {};
+        }
+        m_entries[index].sprite = &sprite;
+        sprite.m_culler = this;
+        sprite.m_culler_index = index;
+        this->refresh(index, true);
+    }
+
+    void SpriteCuller::remove(Sprite& sprite)
+    {
+        if (sprite.m_culler != this || m_entries[sprite.m_culler_index].sprite != &sprite)
+        {
+            return;
+        }
+        this->unlink(sprite.m_culler_index);
+        m_entries[sprite.m_culler_index].sprite = nullptr;
+        m_free_entries.push_back(sprite.m_culler_index);
+        sprite.m_culler = nullptr;
+        sprite.m_culled = false;
+    }
+
+    void SpriteCuller::clear()
+    {
+        for (const Entry& entry : m_entries)
+        {
+            if (entry.sprite)
+            {
+                entry.sprite->m_culler = nullptr;
+                entry.sprite->m_culled = false;
+            }
+        }
+        m_entries.clear();
+        m_free_entries.clear();
+        m_groups.clear();
+        m_stats = CullingStats {};
+    }
+
+    void SpriteCuller::update(const scene::Camera& camera)
+    {
+        m_frame++;
+        m_stats = CullingStats {};
+
+        // ScenePixels bounds are stored in SceneUnits and depend on the Camera zoom
+        const transform::UnitVector pixel_scale
+            = transform::UnitVector(1, 1, transform::Units::ScenePixels)
+                  .to<transform::Units::SceneUnits>();
+        const bool pixel_scale_changed = !same_raw_vector(pixel_scale, m_pixel_scale);
+        m_pixel_scale = pixel_scale;
+
+        for (std::size_t i = 0; i < m_entries.size(); i++)
+        {
+            Entry& entry = m_entries[i];
+            if (!entry.sprite)
+            {
+                continue;
+            }
+            m_stats.sprites++;
+            this->refresh(
+                i, pixel_scale_changed && entry.position.unit == transform::Units::ScenePixels);
+            entry.sprite->m_culled = entry.cullable;
+            if (entry.cullable)
+            {
+                m_stats.culled++;
+            }
+        }
+
+        const transform::UnitVector camera_position
+            = camera.get_position().to<transform::Units::SceneUnits>();
+        const transform::UnitVector camera_size
+            = camera.get_size().to<transform::Units::SceneUnits>();
+        for (const Group& group : m_groups)
+        {
+            if (!group.cullable || (group.cells.empty() && group.oversized.empty()))
+            {
+                continue;
+            }
+            Bounds view;
+            get_visible_range(group.x_transformer, camera_position.x, camera_size.x,
+                group.layer, view.min_x, view.max_x);
+            get_visible_range(group.y_transformer, camera_position.y, camera_size.y,
+                group.layer, view.min_y, view.max_y);
+
+            const int32_t min_x = to_cell(view.min_x, m_cell_size);
+            const int32_t min_y = to_cell(view.min_y, m_cell_size);
+            const int32_t max_x = to_cell(view.max_x, m_cell_size);
+            const int32_t max_y = to_cell(view.max_y, m_cell_size);
+            const double view_cells = (static_cast<double>(max_x) - min_x + 1)
+                * (static_cast<double>(max_y) - min_y + 1);
+            if (view_cells > static_cast<double>(group.cells.size()))
+            {
+                // Zoomed out Camera, walking the occupied cells is cheaper
+                for (const auto& [key, indexes] : group.cells)
+                {
+                    for (const std::size_t index : indexes)
+                    {
+                        this->test(index, view);
+                    }
+                }
+            }
+            else
+            {
+                for (int32_t x = min_x; x <= max_x; x++)
+                {
+                    for (int32_t y = min_y; y <= max_y; y++)
+                    {
+                        const auto cell = group.cells.find(cell_key(x, y));
+                        if (cell == group.cells.end())
+                        {
+                            continue;
+                        }
+                        for (const std::size_t index : cell->second)
+                        {
+                            this->test(index, view);
+                        }
+                    }
+                }
+            }
+            for (const std::size_t index : group.oversized)
+            {
+                this->test(index, view);
+            }
+        }
+    }
+
+    void SpriteCuller::uncull_all()
+    {
+        for (const Entry& entry : m_entries)
+        {
+            if (entry.sprite)
+            {
+                entry.sprite->m_culled = false;
+            }
+        }
+        m_stats.culled = 0;
+    }
+
+    void SpriteCuller::set_cell_size(double cell_size)
+    {
+        m_cell_size = cell_size;
+        for (Group& group : m_groups)
+        {
+            group.cells.clear();
+            group.oversized.clear();
+        }
+        for (std::size_t i = 0; i < m_entries.size(); i++)
+        {
+            Entry& entry = m_entries[i];
+            entry.cullable = false;
+            if (entry.sprite)
+            {
+                this->refresh(i, true);
+            }
+        }
+    }
+
+    double SpriteCuller::get_cell_size() const
+    {
+        return m_cell_size;
+    }
+
+    CullingStats SpriteCuller::get_stats() const
+    {
+        return m_stats;
+    }
+} // namespace obe::graphics
@@ -0,0 +1,185 @@
+#include <algorithm>
+
+#include <Graphics/TextureAtlas.hpp>
+
+namespace obe::graphics
+{
+    ShelfPacker::ShelfPacker(uint32_t width, uint32_t height)
+        : m_width(width)
+        , m_height(height)
+    {
+    }
+
+    std::optional<sf::Vector2u> ShelfPacker::insert(uint32_t width, uint32_t height)
+    {
+        if (width == 0 || height == 0 || width > m_width || height > m_height)
+        {
+            return std::nullopt;
+        }
+        // Best fit : the shelf wasting the least height that still has room for the rectangle
+        Shelf* best_shelf = nullptr;
+        for (Shelf& shelf : m_shelves)
+        {
+            if (shelf.height >= height && m_width - shelf.width >= width
+                && (!best_shelf || shelf.height < best_shelf->height))
+            {
+                best_shelf = &shelf;
+            }
+        }
+        if (!best_shelf)
+        {
+            if (m_height - m_next_shelf_y < height)
+            {
+                return std::nullopt;
+            }
+            best_shelf = &m_shelves.emplace_back(Shelf { m_next_shelf_y, height, 0 });
+            m_next_shelf_y += height;
+        }
+        const sf::Vector2u position(best_shelf->width, best_shelf->y);
+        best_shelf->width += width;
+        m_used_area += static_cast<uint64_t>(width) * height;
+        return position;
+    }
+
+    uint32_t ShelfPacker::get_width() const
+    {
+        return m_width;
+    }
+
+    uint32_t ShelfPacker::get_height() const
+    {
+        return m_height;
+    }
+
+    uint64_t ShelfPacker::get_used_area() const
+    {
+        return m_used_area;
+    }
+
+    TextureAtlas::Page& TextureAtlas::create_page()
+    {
+        auto page = std::make_unique<Page>(
+            Page { Texture::make_shared_texture(), ShelfPacker(m_page_size, m_page_size) });
+        page->texture.create(m_page_size, m_page_size);
+        page->texture.set_anti_aliasing(m_anti_aliasing);
+        m_pages.push_back(std::move(page));
+        return *m_pages.back();
+    }
+
+    TextureAtlas::TextureAtlas(uint32_t page_size, bool anti_aliasing)
+        : m_page_size(std::min(page_size, sf::Texture::getMaximumSize()))
+        , m_anti_aliasing(anti_aliasing)
+    {
+    }
+
+    const TexturePart* TextureAtlas::find(const std::string& name) const
+    {
+        const auto part = m_parts.find(name);
+        if (part != m_parts.end())
+        {
+            return &part->second;
+        }
+        return nullptr;
+    }
+
+    const TexturePart* TextureAtlas::insert(const std::string& name, const sf::Image& image)
+    {
+        if (const TexturePart* existing_part = this->find(name))
+        {
+            return existing_part;
+        }
+        const sf::Vector2u image_size = image.getSize();
+        const uint32_t slot_width = image_size.x + Padding * 2;
+        const uint32_t slot_height = image_size.y + Padding * 2;
+        if (image_size.x == 0 || image_size.y == 0 || slot_width > m_page_size
+            || slot_height > m_page_size)
+        {
+            return nullptr;
+        }
+
+        Page* target_page = nullptr;
+        std::optional<sf::Vector2u> position;
+        for (const std::unique_ptr<Page>& page : m_pages)
+        {
+            if ((position = page->packer.insert(slot_width, slot_height)))
+            {
+                target_page = page.get();
+                break;
+            }
+        }
+        if (!target_page)
+        {
+            target_page = &this->create_page();
+            position = target_page->packer.insert(slot_width, slot_height);
+        }
+
+        // Copies the image with its edges extruded in the padding
+        const int image_width = static_cast<int>(image_size.x);
+        const int image_height = static_cast<int>(image_size.y);
+        const uint32_t right = Padding + image_size.x;
+        const uint32_t bottom = Padding + image_size.y;
+        sf::Image slot;
+        slot.create(slot_width, slot_height);
+        slot.copy(image, Padding, Padding);
+        for (uint32_t offset = 0; offset < Padding; offset++)
+        {
+            slot.copy(image, Padding, offset, sf::IntRect(0, 0, image_width, 1));
+            slot.copy(image, Padding, bottom + offset,
+                sf::IntRect(0, image_height - 1, image_width, 1));
+            slot.copy(image, offset, Padding, sf::IntRect(0, 0, 1, image_height));
+            slot.copy(image, right + offset, Padding,
+                sf::IntRect(image_width - 1, 0, 1, image_height));
+        }
+        for (uint32_t y = 0; y < Padding; y++)
+        {
+            for (uint32_t x = 0; x < Padding; x++)
+            {
+                slot.setPixel(x, y, image.getPixel(0, 0));
+                slot.setPixel(right + x, y, image.getPixel(image_size.x - 1, 0));
+                slot.setPixel(x, bottom + y, image.getPixel(0, image_size.y - 1));
+                slot.setPixel(
+                    right + x, bottom + y, image.getPixel(image_size.x - 1, image_size.y - 1));
+            }
+        }
+        static_cast<sf::Texture&>(target_page->texture).update(slot, position->x, position->y);
+
+        const transform::AABB rect(transform::UnitVector(position->x + Padding,
+                                       position->y + Padding, transform::Units::ScenePixels),
+            transform::UnitVector(image_size.x, image_size.y, transform::Units::ScenePixels));
+        return &m_parts.emplace(name, TexturePart(target_page->texture, rect)).first->second;
+    }
+
+    uint32_t TextureAtlas::get_page_size() const
+    {
+        return m_page_size;
+    }
+
+    std::size_t TextureAtlas::get_page_count() const
+    {
+        return m_pages.size();
+    }
+
+    const Texture& TextureAtlas::get_page(std::size_t index) const
+    {
+        return m_pages.at(index)->texture;
+    }
+
+    TextureAtlasStats TextureAtlas::get_stats() const
+    {
+        TextureAtlasStats stats;
+        stats.pages = m_pages.size();
+        stats.images = m_parts.size();
+        for (const std::unique_ptr<Page>& page : m_pages)
+        {
+            stats.used_pixels += page->packer.get_used_area();
+            stats.total_pixels += static_cast<uint64_t>(page->packer.get_width())
+                * page->packer.get_height();
+        }
+        if (stats.total_pixels)
+        {
+            stats.occupancy
+                = static_cast<double>(stats.used_pixels) / static_cast<double>(stats.total_pixels);
+        }
+        return stats;
+    }
+} // namespace obe::graphics
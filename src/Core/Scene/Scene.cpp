@@ -7,33 +7,6 @@
 
 namespace obe::scene
 {
-    void Scene::_reorganize_layers()
-    {
-        m_render_cache.clear();
-        for (const auto& sprite : m_sprite_array)
-        {
-            m_render_cache.push_back(sprite.get());
-        }
-        if (m_tiles)
-        {
-            std::vector<graphics::Renderable*> tile_layers = m_tiles->get_renderables();
-            m_render_cache.insert(m_render_cache.end(), tile_layers.begin(), tile_layers.end());
-        }
-
-        std::sort(m_render_cache.begin(), m_render_cache.end(),
-            [](const auto& renderable1, const auto& renderable2) {
-                if (renderable1->get_layer() == renderable2->get_layer())
-                {
-                    return renderable1->get_sublayer() > renderable2->get_sublayer();
-                }
-                else
-                {
-                    return renderable1->get_layer() > renderable2->get_layer();
-                }
-            });
-        m_sort_renderables = false;
-    }
-
     void Scene::_rebuild_ids()
     {
         m_sprite_ids.clear();
@@ -59,6 +32,43 @@ namespace obe::scene
 
     {
         e_scene->add<events::Scene::Loaded>();
+        e_scene->add<events::Scene::CollisionBegin>();
+        e_scene->add<events::Scene::CollisionStay>();
+        e_scene->add<events::Scene::CollisionEnd>();
+        for (const std::string_view event_name : { events::Scene::CollisionBegin::id,
+                 events::Scene::CollisionStay::id, events::Scene::CollisionEnd::id })
+        {
+            e_scene->on_add_listener(std::string(event_name),
+                [this](event::ListenerChangeState, const std::string&) {
+                    m_collision_listeners++;
+                });
+            e_scene->on_remove_listener(std::string(event_name),
+                [this](event::ListenerChangeState, const std::string&) {
+                    if (m_collision_listeners > 0)
+                        m_collision_listeners--;
+                    // Contacts are not tracked without listeners, the stored ones would be
+                    // stale by the time a listener is added again
+                    if (m_collision_listeners == 0)
+                        m_collision_space.reset_contacts();
+                });
+        }
+    }
+
+    void Scene::trigger_collision_events()
+    {
+        const collision::ContactChanges contacts = m_collision_space.update_contacts();
+        for (const auto& [collider1, collider2] : contacts.ended)
+        {
+            e_scene->trigger(events::Scene::CollisionEnd { collider1, collider2 });
+        }
+        for (const auto& [collider1, collider2] : contacts.began)
+        {
+            e_scene->trigger(events::Scene::CollisionBegin { collider1, collider2 });
+        }
+        for (const auto& [collider1, collider2] : contacts.stayed)
+        {
+            e_scene->trigger(events::Scene::CollisionStay { collider1, collider2 });
+        }
     }
 
     graphics::Sprite& Scene::create_sprite(const std::string& id, bool add_to_scene_root)
@@ -89,7 +99,8 @@ namespace obe::scene
             if (add_to_scene_root)
                 m_scene_root.add_child(*return_sprite);
 
-            this->reorganize_layers();
+            m_render_queue.add(*return_sprite);
+            m_sprite_culler.add(*return_sprite);
             return *return_sprite;
         }
         else
@@ -204,8 +215,13 @@ namespace obe::scene
             }
         }
         debug::Log->debug("<Scene> Cleaning GameObject Array");
-        std::erase_if(m_game_object_array,
-            [](const std::unique_ptr<script::GameObject>& ptr) { return (!ptr->is_permanent()); });
+        std::erase_if(
+            m_game_object_array, [this](const std::unique_ptr<script::GameObject>& ptr) {
+                if (ptr->is_permanent())
+                    return false;
+                m_trajectory_system.remove_nodes(ptr->get_scene_node());
+                return true;
+            });
         // Required for the next does_game_object_exists
         this->_rebuild_ids();
         debug::Log->debug("<Scene> Cleaning Sprite Array");
@@ -246,6 +262,23 @@ namespace obe::scene
 
         // Meta
         result["Meta"] = vili::object { { "name", m_level_name } };
+        const collision::BroadphaseType broadphase = m_collision_space.get_broadphase();
+        if (broadphase == collision::BroadphaseType::SpatialHashGrid)
+        {
+            result["Meta"]["broadphase"]
+                = vili::object { { "type", collision::BroadphaseTypeMeta::to_string(broadphase) },
+                      { "cell_size", m_collision_space.get_grid_cell_size() } };
+        }
+        else if (m_collision_space.get_quadtree_threshold() != collision::Quadtree::DefaultThreshold
+            || m_collision_space.get_quadtree_max_depth() != collision::Quadtree::DefaultMaxDepth)
+        {
+            result["Meta"]["broadphase"] = vili::object {
+                { "type", collision::BroadphaseTypeMeta::to_string(broadphase) },
+                { "threshold",
+                    static_cast<vili::integer>(m_collision_space.get_quadtree_threshold()) },
+                { "max_depth",
+                    static_cast<vili::integer>(m_collision_space.get_quadtree_max_depth()) } };
+        }
 
         // View
         result["View"] = vili::object {};
@@ -312,6 +345,32 @@ namespace obe::scene
             {
                 m_background.from_string(meta.at("background").as<vili::string>());
             }
+            // Scenes without a broadphase block go back to the default one
+            collision::BroadphaseType broadphase_type = collision::BroadphaseType::Quadtree;
+            double cell_size = collision::SpatialHashGrid::DefaultCellSize;
+            std::size_t threshold = collision::Quadtree::DefaultThreshold;
+            std::size_t max_depth = collision::Quadtree::DefaultMaxDepth;
+            if (meta.contains("broadphase"))
+            {
+                const vili::node& broadphase = meta.at("broadphase");
+                broadphase_type = collision::BroadphaseTypeMeta::from_string(
+                    broadphase.at("type").as<vili::string>());
+                if (broadphase.contains("cell_size"))
+                {
+                    cell_size = broadphase.at("cell_size").as<vili::number>();
+                }
+                if (broadphase.contains("threshold"))
+                {
+                    threshold = broadphase.at("threshold").as<vili::integer>();
+                }
+                if (broadphase.contains("max_depth"))
+                {
+                    max_depth = broadphase.at("max_depth").as<vili::integer>();
+                }
+            }
+            m_collision_space.set_grid_cell_size(cell_size);
+            m_collision_space.set_quadtree_limits(threshold, max_depth);
+            m_collision_space.set_broadphase(broadphase_type);
         }
         else
             throw exceptions::MissingSceneFileBlock(m_level_file_name, "Meta");
@@ -381,6 +440,10 @@ namespace obe::scene
         {
             m_tiles = std::make_unique<tiles::TileScene>(*this);
             m_tiles->load(data.at("Tiles"));
+            for (graphics::Renderable* tile_layer : m_tiles->get_renderables())
+            {
+                m_render_queue.add(*tile_layer);
+            }
         }
 
         if (data.contains("GameObjects"))
@@ -441,8 +504,6 @@ namespace obe::scene
             }
         }
 
-        this->reorganize_layers();
-
         e_scene->trigger(events::Scene::Loaded { m_level_file_name });
     }
 
@@ -499,28 +560,41 @@ namespace obe::scene
                             this->remove_sprite(ptr->get_sprite().get_id());
                         if (ptr->m_collider)
                             this->remove_collider(ptr->get_collider().get_id());
+                        m_trajectory_system.remove_nodes(ptr->get_scene_node());
                         return true;
                     }
                     return false;
                 });
             if (m_tiles)
                 m_tiles->update();
+            m_collision_space.update();
+            if (m_collision_listeners > 0)
+                this->trigger_collision_events();
         }
     }
 
     void Scene::draw(graphics::RenderTarget surface)
     {
-        this->_reorganize_layers();
         surface.clear(m_background);
         if (m_render_options.sprites)
         {
-            for (const auto& renderable : m_render_cache)
+            if (m_render_options.culling)
+                m_sprite_culler.update(m_camera);
+            else
+                m_sprite_culler.uncull_all();
+            m_sprite_batch.reset_stats();
+            for (graphics::Renderable* renderable : m_render_queue.get_renderables())
             {
-                if (renderable->is_visible())
+                if (!renderable->is_visible() || renderable->is_culled())
                 {
-                    renderable->draw(surface, m_camera);
+                    continue;
                 }
+                if (m_render_options.batching)
+                    renderable->draw_batched(surface, m_camera, m_sprite_batch);
+                else
+                    renderable->draw(surface, m_camera);
             }
+            m_sprite_batch.flush(surface);
         }
 
         // m_tiles->draw(surface, m_camera);
@@ -584,6 +658,7 @@ namespace obe::scene
     void Scene::set_update_state(bool state)
     {
         m_update_state = state;
+        m_trajectory_system.set_enabled(state);
         for (const auto& game_object : m_game_object_array)
         {
             game_object->set_state(state);
@@ -680,7 +755,7 @@ namespace obe::scene
 
     void Scene::reorganize_layers()
     {
-        m_sort_renderables = true;
+        m_render_queue.invalidate();
     }
 
     std::size_t Scene::get_sprite_amount() const
@@ -803,6 +878,16 @@ namespace obe::scene
         m_render_options = options;
     }
 
+    graphics::CullingStats Scene::get_culling_stats() const
+    {
+        return m_sprite_culler.get_stats();
+    }
+
+    graphics::SpriteBatchStats Scene::get_sprite_batch_stats() const
+    {
+        return m_sprite_batch.get_stats();
+    }
+
     component::ComponentBase* Scene::get_component(const std::string& id) const
     {
         return m_components.at(id);
@@ -847,6 +932,11 @@ namespace obe::scene
         return m_collision_space;
     }
 
+    collision::TrajectorySystem& Scene::get_trajectory_system()
+    {
+        return m_trajectory_system;
+    }
+
     SceneNode& Scene::get_scene_root_node()
     {
         return m_scene_root;
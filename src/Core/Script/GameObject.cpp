@@ -179,7 +179,6 @@ namespace obe::script
             m_object_node.add_child(*m_sprite);
             m_sprite->load(obj.at("Sprite"));
             m_sprite->set_parent_id(m_id);
-            scene.reorganize_layers();
         }
         if (obj.contains("Animator"))
         {
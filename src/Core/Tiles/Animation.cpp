@@ -58,7 +58,7 @@ namespace obe::tiles
     void AnimatedTile::start()
     {
         m_started = true;
-        m_clock = time::epoch();
+        m_clock = time::now();
     }
 
     void AnimatedTile::stop()
@@ -73,14 +73,14 @@ namespace obe::tiles
 
     void AnimatedTile::update()
     {
-        if (m_started && time::epoch() - m_clock >= m_sleeps[m_index])
+        if (m_started && time::now() - m_clock >= m_sleeps[m_index])
         {
             m_index++;
             if (m_index == m_sleeps.size())
             {
                 m_index = 0;
             }
-            m_clock = time::epoch();
+            m_clock = time::now();
             for (const auto& quad : m_quads)
             {
                 update_quad(quad.first, m_tileset, m_tile_ids[m_index], quad.second);
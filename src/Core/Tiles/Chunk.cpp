@@ -0,0 +1,252 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <Tiles/Chunk.hpp>
+
+namespace obe::tiles
+{
+    std::optional<TileRect> get_cells_in_area(const sf::FloatRect& area, uint32_t cell_width,
+        uint32_t cell_height, uint32_t columns, uint32_t rows)
+    {
+        if (!cell_width || !cell_height || !columns || !rows)
+        {
+            return std::nullopt;
+        }
+        const double left = std::floor(area.left / cell_width);
+        const double top = std::floor(area.top / cell_height);
+        const double right = std::floor((area.left + area.width) / cell_width);
+        const double bottom = std::floor((area.top + area.height) / cell_height);
+        if (right < 0 || bottom < 0 || left >= columns || top >= rows)
+        {
+            return std::nullopt;
+        }
+        TileRect cells;
+        cells.left = static_cast<uint32_t>(std::max(left, 0.0));
+        cells.top = static_cast<uint32_t>(std::max(top, 0.0));
+        cells.right = static_cast<uint32_t>(std::min(right, columns - 1.0));
+        cells.bottom = static_cast<uint32_t>(std::min(bottom, rows - 1.0));
+        return cells;
+    }
+
+    std::optional<TileRect> get_chunks_in_area(const sf::FloatRect& area,
+        const std::vector<sf::Vector2u>& tile_sizes, uint32_t chunks_width,
+        uint32_t chunks_height)
+    {
+        std::optional<TileRect> chunks;
+        for (const sf::Vector2u& tile_size : tile_sizes)
+        {
+            const std::optional<TileRect> cells = get_cells_in_area(area,
+                tile_size.x * TileChunk::Size, tile_size.y * TileChunk::Size, chunks_width,
+                chunks_height);
+            if (!cells)
+            {
+                continue;
+            }
+            if (!chunks)
+            {
+                chunks = cells;
+                continue;
+            }
+            chunks->left = std::min(chunks->left, cells->left);
+            chunks->top = std::min(chunks->top, cells->top);
+            chunks->right = std::max(chunks->right, cells->right);
+            chunks->bottom = std::max(chunks->bottom, cells->bottom);
+        }
+        return chunks;
+    }
+
+    bool is_whole_tile_collider(const collision::ComplexPolygonCollider& collider,
+        uint32_t tile_width, uint32_t tile_height)
+    {
+        const std::vector<transform::UnitVector>& points = collider.get_points();
+        if (points.size() != 4)
+        {
+            return false;
+        }
+        const double width = tile_width;
+        const double height = tile_height;
+        const std::array<std::pair<double, double>, 4> corners
+            = { { { 0, 0 }, { width, 0 }, { width, height }, { 0, height } } };
+        const auto is_corner = [&](const transform::UnitVector& point, std::size_t corner) {
+            constexpr double epsilon = 0.01;
+            const transform::UnitVector pixels = point.to<transform::Units::ScenePixels>();
+            return std::abs(pixels.x - corners[corner].first) < epsilon
+                && std::abs(pixels.y - corners[corner].second) < epsilon;
+        };
+        for (std::size_t first_corner = 0; first_corner < 4; first_corner++)
+        {
+            if (!is_corner(points[0], first_corner))
+            {
+                continue;
+            }
+            bool clockwise = true;
+            bool counter_clockwise = true;
+            for (std::size_t i = 1; i < 4; i++)
+            {
+                clockwise = clockwise && is_corner(points[i], (first_corner + i) % 4);
+                counter_clockwise
+                    = counter_clockwise && is_corner(points[i], (first_corner + 4 - i) % 4);
+            }
+            return clockwise || counter_clockwise;
+        }
+        return false;
+    }
+
+    std::vector<TileRect> merge_cells(
+        const std::vector<uint32_t>& groups, uint32_t columns, uint32_t rows)
+    {
+        std::vector<TileRect> rects;
+        std::vector<bool> merged(groups.size(), false);
+        const auto is_free = [&](uint32_t x, uint32_t y, uint32_t group) {
+            const uint32_t index = x + y * columns;
+            return !merged[index] && groups[index] == group;
+        };
+        for (uint32_t y = 0; y < rows; y++)
+        {
+            for (uint32_t x = 0; x < columns; x++)
+            {
+                const uint32_t group = groups[x + y * columns];
+                if (!group || merged[x + y * columns])
+                {
+                    continue;
+                }
+                // Widest run of the row first, then as many rows below as it fits in
+                TileRect rect { x, y, x, y };
+                while (rect.right + 1 < columns && is_free(rect.right + 1, y, group))
+                {
+                    rect.right++;
+                }
+                while (rect.bottom + 1 < rows)
+                {
+                    bool row_fits = true;
+                    for (uint32_t column = rect.left; column <= rect.right && row_fits; column++)
+                    {
+                        row_fits = is_free(column, rect.bottom + 1, group);
+                    }
+                    if (!row_fits)
+                    {
+                        break;
+                    }
+                    rect.bottom++;
+                }
+                for (uint32_t row = rect.top; row <= rect.bottom; row++)
+                {
+                    for (uint32_t column = rect.left; column <= rect.right; column++)
+                    {
+                        merged[column + row * columns] = true;
+                    }
+                }
+                rects.push_back(rect);
+            }
+        }
+        return rects;
+    }
+
+    uint32_t TileChunk::get_tile_index(uint32_t x, uint32_t y)
+    {
+        return x + y * Size;
+    }
+
+    TileChunk::TileChunk(uint32_t x, uint32_t y)
+        : m_x(x)
+        , m_y(y)
+    {
+    }
+
+    sf::Vertex* TileChunk::acquire_quad(uint32_t first_tile_id, uint32_t x, uint32_t y)
+    {
+        auto tileset_quads = std::find_if(m_quads.begin(), m_quads.end(),
+            [first_tile_id](const TilesetQuads& quads) {
+                return quads.first_tile_id == first_tile_id;
+            });
+        if (tileset_quads == m_quads.end())
+        {
+            // Allocated once with the full capacity so quads never move
+            TilesetQuads new_quads;
+            new_quads.first_tile_id = first_tile_id;
+            new_quads.vertices.resize(Size * Size * 4);
+            m_quads.push_back(std::move(new_quads));
+            tileset_quads = std::prev(m_quads.end());
+        }
+        const uint32_t tile_index = get_tile_index(x, y);
+        tileset_quads->tiles.set(tile_index);
+        return &tileset_quads->vertices[tile_index * 4];
+    }
+
+    void TileChunk::release_quad(uint32_t first_tile_id, uint32_t x, uint32_t y)
+    {
+        const auto tileset_quads = std::find_if(m_quads.begin(), m_quads.end(),
+            [first_tile_id](const TilesetQuads& quads) {
+                return quads.first_tile_id == first_tile_id;
+            });
+        if (tileset_quads == m_quads.end())
+        {
+            return;
+        }
+        const uint32_t tile_index = get_tile_index(x, y);
+        if (!tileset_quads->tiles.test(tile_index))
+        {
+            return;
+        }
+        tileset_quads->tiles.reset(tile_index);
+        if (tileset_quads->tiles.none())
+        {
+            m_quads.erase(tileset_quads);
+            return;
+        }
+        sf::Vertex* quad = &tileset_quads->vertices[tile_index * 4];
+        for (uint8_t i = 0; i < 4; i++)
+        {
+            quad[i].position = sf::Vector2f(0, 0);
+            quad[i].texCoords = sf::Vector2f(0, 0);
+        }
+    }
+
+    sf::Vertex* TileChunk::get_quad(uint32_t first_tile_id, uint32_t x, uint32_t y)
+    {
+        for (TilesetQuads& quads : m_quads)
+        {
+            if (quads.first_tile_id == first_tile_id)
+            {
+                return &quads.vertices[get_tile_index(x, y) * 4];
+            }
+        }
+        return nullptr;
+    }
+
+    void TileChunk::clear()
+    {
+        m_quads.clear();
+    }
+
+    uint32_t TileChunk::get_x() const
+    {
+        return m_x;
+    }
+
+    uint32_t TileChunk::get_y() const
+    {
+        return m_y;
+    }
+
+    bool TileChunk::is_empty() const
+    {
+        return m_quads.empty();
+    }
+
+    const std::vector<TileChunk::TilesetQuads>& TileChunk::get_quads() const
+    {
+        return m_quads;
+    }
+
+    std::size_t TileChunk::get_vertex_count() const
+    {
+        std::size_t vertex_count = 0;
+        for (const TilesetQuads& quads : m_quads)
+        {
+            vertex_count += quads.vertices.size();
+        }
+        return vertex_count;
+    }
+} // namespace obe::tiles
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cmath>
+
 #include <Graphics/DrawUtils.hpp>
 #include <Scene/Scene.hpp>
 #include <Tiles/Exceptions.hpp>
@@ -29,70 +32,62 @@ void main()\n\
 
 namespace obe::tiles
 {
+    TileChunk& TileLayer::get_chunk(uint32_t x, uint32_t y)
+    {
+        return m_chunks[(x / TileChunk::Size) + (y / TileChunk::Size) * m_chunks_width];
+    }
+
+    void TileLayer::build_chunk(TileChunk& chunk)
+    {
+        const uint32_t start_x = chunk.get_x() * TileChunk::Size;
+        const uint32_t start_y = chunk.get_y() * TileChunk::Size;
+        const uint32_t end_x = std::min(start_x + TileChunk::Size, m_width);
+        const uint32_t end_y = std::min(start_y + TileChunk::Size, m_height);
+        for (uint32_t y = start_y; y < end_y; ++y)
+        {
+            for (uint32_t x = start_x; x < end_x; ++x)
+            {
+                const uint32_t tile_data_index = x + y * m_width;
+                build_tile(x, y, m_data[tile_data_index]);
+            }
+        }
+    }
+
     void TileLayer::build_tile(uint32_t x, uint32_t y, uint32_t tile_id)
     {
         if (!tile_id)
             return;
 
-        const uint32_t tile_index = y + x * m_height;
         const uint32_t tile_data_index = x + y * m_width;
 
         const TileInfo tile_info = get_tile_info(tile_id);
 
         const Tileset& tileset = m_scene.get_tilesets().tileset_from_tile_id(tile_info.tile_id);
         const uint32_t first_tile_id = tileset.get_first_tile_id();
-        sfe::SpannableVertexArray& vertices = m_sublayers_by_tileset[tileset.get_first_tile_id()];
-        sf::Vertex* quad = &vertices[tile_index * 4];
-        for (auto& animation : m_scene.get_animated_tiles())
+        sf::Vertex* quad = this->get_chunk(x, y).acquire_quad(
+            first_tile_id, x % TileChunk::Size, y % TileChunk::Size);
+        if (AnimatedTile* animation = m_scene.get_animated_tile(tile_info.tile_id))
         {
-            if (animation->get_id() == tile_info.tile_id)
-            {
-                animation->attach_quad(quad, tile_info);
-                break;
-            }
+            animation->attach_quad(quad, tile_info);
         }
-        for (auto& collider : m_scene.get_collider_models())
+        if (!m_colliders.contains(tile_data_index))
         {
-            if (collider->get_id() == std::to_string(tile_info.tile_id))
-            {
-                m_colliders[tile_data_index] = &m_scene.get_scene().create_collider();
-                (*m_colliders[tile_data_index]) = *collider;
-                // m_colliders[tile_data_index]->set_parent_id("tile_" + std::to_string(tile_info.tile_id));
-                // TODO: Fix this horrible code
-                // TODO: I mean, really, fix this
-                auto camera_size_backup = m_scene.get_scene().get_camera().get_size().y / 2;
-                m_scene.get_scene().get_camera().set_size(1);
-                transform::UnitVector collider_offset = collider->get_inner_collider()
-                                                            ->get_position()
-                                                            .to<transform::Units::ScenePixels>();
-                m_colliders.at(tile_data_index)
-                    ->get_inner_collider()
-                    ->set_position(
-                        transform::UnitVector(x * tileset.get_tile_width() + collider_offset.x,
-                            y * tileset.get_tile_height() + collider_offset.y,
-                            transform::Units::ScenePixels));
-                // Backup camera size
-                m_scene.get_scene().get_camera().set_size(camera_size_backup);
-            }
+            this->build_tile_collider(x, y, tile_info.tile_id);
         }
-        for (const auto& game_object : m_scene.get_game_objects_models())
+        for (const vili::node* game_object :
+            m_scene.get_tile_game_objects_models(tile_info.tile_id))
         {
-            if (game_object.at("tileId").as<vili::integer>() == tile_info.tile_id)
-            {
-                std::string game_object_id = utils::string::replace(game_object.at("id"), "{index}",
-                    std::to_string(m_scene.get_scene().get_game_object_amount()));
-                vili::node requirements = game_object.at("Requires");
-                transform::UnitVector game_object_position(x * tileset.get_tile_width(),
-                    y * tileset.get_tile_height(), transform::Units::ScenePixels);
-                requirements["x"] = requirements["x"].as_number() + game_object_position.x;
-                requirements["y"] = requirements["y"].as_number() + game_object_position.y;
-                m_scene.get_scene()
-                    .create_game_object(game_object.at("type"), game_object_id)
-                    .init_from_vili(requirements);
-            }
+            std::string game_object_id = utils::string::replace(game_object->at("id"), "{index}",
+                std::to_string(m_scene.get_scene().get_game_object_amount()));
+            vili::node requirements = game_object->at("Requires");
+            transform::UnitVector game_object_position(x * tileset.get_tile_width(),
+                y * tileset.get_tile_height(), transform::Units::ScenePixels);
+            requirements["x"] = requirements["x"].as_number() + game_object_position.x;
+            requirements["y"] = requirements["y"].as_number() + game_object_position.y;
+            m_scene.get_scene()
+                .create_game_object(game_object->at("type"), game_object_id)
+                .init_from_vili(requirements);
         }
-        m_positions[tile_index] = quad;
-
         const uint32_t tile_width = tileset.get_tile_width();
         const uint32_t tile_height = tileset.get_tile_height();
 
@@ -118,30 +113,196 @@ namespace obe::tiles
             = sf::Vector2f(texture_x * tile_width, (texture_y + 1) * tile_height);
     }
 
-    void TileLayer::clear_tile(uint32_t x, uint32_t y)
+    void TileLayer::build_tile_collider(uint32_t x, uint32_t y, uint32_t tile_id)
     {
-        const uint32_t tile_index = y + x * m_height;
+        collision::ColliderComponent* collider = m_scene.get_collider_model(tile_id);
+        if (!collider)
+        {
+            return;
+        }
         const uint32_t tile_data_index = x + y * m_width;
-        sf::Vertex* quad = m_positions[tile_index];
-        const uint32_t old_tile_id = m_data[tile_data_index];
-        for (const auto& animation : m_scene.get_animated_tiles())
+        const Tileset& tileset = m_scene.get_tilesets().tileset_from_tile_id(tile_id);
+        m_colliders[tile_data_index] = &m_scene.get_scene().create_collider();
+        (*m_colliders[tile_data_index]) = *collider;
+        // m_colliders[tile_data_index]->set_parent_id("tile_" + std::to_string(tile_info.tile_id));
+        // TODO: Fix this horrible code
+        // TODO: I mean, really, fix this
+        auto camera_size_backup = m_scene.get_scene().get_camera().get_size().y / 2;
+        m_scene.get_scene().get_camera().set_size(1);
+        transform::UnitVector collider_offset = collider->get_inner_collider()
+                                                    ->get_position()
+                                                    .to<transform::Units::ScenePixels>();
+        m_colliders.at(tile_data_index)
+            ->get_inner_collider()
+            ->set_position(
+                transform::UnitVector(x * tileset.get_tile_width() + collider_offset.x,
+                    y * tileset.get_tile_height() + collider_offset.y,
+                    transform::Units::ScenePixels));
+        // Backup camera size
+        m_scene.get_scene().get_camera().set_size(camera_size_backup);
+    }
+
+    void TileLayer::build_merged_colliders()
+    {
+        scene::Camera& camera = m_scene.get_scene().get_camera();
+        const auto camera_size_backup = camera.get_size().y / 2;
+        camera.set_size(1);
+
+        // Tiles whose collider model is a rectangle covering the whole tile are merged with
+        // their neighbours as long as they share the same tag and tile size
+        struct MergeGroup
+        {
+            std::string tag;
+            uint32_t tile_width;
+            uint32_t tile_height;
+        };
+        std::vector<MergeGroup> merge_groups;
+        std::unordered_map<uint32_t, uint32_t> groups_by_tile_id;
+        const auto get_merge_group = [&](uint32_t tile_id) -> uint32_t {
+            if (const auto group = groups_by_tile_id.find(tile_id);
+                group != groups_by_tile_id.end())
+            {
+                return group->second;
+            }
+            uint32_t group = 0;
+            collision::ColliderComponent* model = m_scene.get_collider_model(tile_id);
+            if (model
+                && model->get_inner_collider()->get_collider_type()
+                    == collision::ColliderType::ComplexPolygon)
+            {
+                const Tileset& tileset = m_scene.get_tilesets().tileset_from_tile_id(tile_id);
+                if (is_whole_tile_collider(
+                        *model->get_inner_collider<collision::ComplexPolygonCollider>(),
+                        tileset.get_tile_width(), tileset.get_tile_height()))
+                {
+                    const std::string tag = model->get_inner_collider()->get_tag();
+                    const auto same_group = std::find_if(merge_groups.begin(),
+                        merge_groups.end(), [&](const MergeGroup& merge_group) {
+                            return merge_group.tag == tag
+                                && merge_group.tile_width == tileset.get_tile_width()
+                                && merge_group.tile_height == tileset.get_tile_height();
+                        });
+                    if (same_group == merge_groups.end())
+                    {
+                        merge_groups.push_back(
+                            { tag, tileset.get_tile_width(), tileset.get_tile_height() });
+                        group = static_cast<uint32_t>(merge_groups.size());
+                    }
+                    else
+                    {
+                        group = static_cast<uint32_t>(
+                            std::distance(merge_groups.begin(), same_group) + 1);
+                    }
+                }
+            }
+            groups_by_tile_id.emplace(tile_id, group);
+            return group;
+        };
+
+        std::vector<uint32_t> groups(m_data.size(), 0);
+        for (uint32_t tile_data_index = 0; tile_data_index < m_data.size(); ++tile_data_index)
+        {
+            if (m_data[tile_data_index] && !m_colliders.contains(tile_data_index))
+            {
+                groups[tile_data_index]
+                    = get_merge_group(get_tile_info(m_data[tile_data_index]).tile_id);
+            }
+        }
+        for (const TileRect& rect : merge_cells(groups, m_width, m_height))
         {
-            if (animation->get_id() == old_tile_id)
+            // Lone tiles keep a regular collider built with the tile
+            if (rect.left == rect.right && rect.top == rect.bottom)
+            {
+                continue;
+            }
+            const uint32_t tile_id = get_tile_info(m_data[rect.left + rect.top * m_width]).tile_id;
+            const collision::ColliderComponent& model = *m_scene.get_collider_model(tile_id);
+            const MergeGroup& merge_group
+                = merge_groups[groups[rect.left + rect.top * m_width] - 1];
+            const double left = rect.left * merge_group.tile_width;
+            const double top = rect.top * merge_group.tile_height;
+            const double right = (rect.right + 1) * merge_group.tile_width;
+            const double bottom = (rect.bottom + 1) * merge_group.tile_height;
+
+            collision::ComplexPolygonCollider shape;
+            shape.add_point(transform::UnitVector(left, top, transform::Units::ScenePixels));
+            shape.add_point(transform::UnitVector(right, top, transform::Units::ScenePixels));
+            shape.add_point(transform::UnitVector(right, bottom, transform::Units::ScenePixels));
+            shape.add_point(transform::UnitVector(left, bottom, transform::Units::ScenePixels));
+            shape.set_tag(merge_group.tag);
+
+            collision::ColliderComponent& collider = m_scene.get_scene().create_collider();
+            collider = model;
+            *collider.get_inner_collider<collision::ComplexPolygonCollider>() = shape;
+            m_merged_colliders.emplace(&collider, rect);
+            for (uint32_t y = rect.top; y <= rect.bottom; ++y)
             {
-                animation->detach_quad(quad);
-                break;
+                for (uint32_t x = rect.left; x <= rect.right; ++x)
+                {
+                    m_colliders[x + y * m_width] = &collider;
+                }
             }
         }
-        if (const auto tile_collision = m_colliders.find(tile_data_index);
-            tile_collision != m_colliders.end())
+
+        camera.set_size(camera_size_backup);
+    }
+
+    void TileLayer::split_merged_collider(collision::ColliderComponent* collider)
+    {
+        const auto merged_collider = m_merged_colliders.find(collider);
+        if (merged_collider == m_merged_colliders.end())
+        {
+            return;
+        }
+        const TileRect rect = merged_collider->second;
+        m_merged_colliders.erase(merged_collider);
+        m_scene.get_scene().remove_collider(collider->get_id());
+        for (uint32_t y = rect.top; y <= rect.bottom; ++y)
+        {
+            for (uint32_t x = rect.left; x <= rect.right; ++x)
+            {
+                m_colliders.erase(x + y * m_width);
+            }
+        }
+        for (uint32_t y = rect.top; y <= rect.bottom; ++y)
+        {
+            for (uint32_t x = rect.left; x <= rect.right; ++x)
+            {
+                this->build_tile_collider(x, y, get_tile_info(m_data[x + y * m_width]).tile_id);
+            }
+        }
+    }
+
+    void TileLayer::clear_tile(uint32_t x, uint32_t y)
+    {
+        const uint32_t tile_data_index = x + y * m_width;
+        const uint32_t old_tile_id = m_data[tile_data_index];
+        const TileInfo tile_info = get_tile_info(old_tile_id);
+        const uint32_t first_tile_id
+            = m_scene.get_tilesets().tileset_from_tile_id(tile_info.tile_id).get_first_tile_id();
+        TileChunk& chunk = this->get_chunk(x, y);
+        const uint32_t chunk_x = x % TileChunk::Size;
+        const uint32_t chunk_y = y % TileChunk::Size;
+        sf::Vertex* quad = chunk.get_quad(first_tile_id, chunk_x, chunk_y);
+        if (AnimatedTile* animation = m_scene.get_animated_tile(tile_info.tile_id))
+        {
+            animation->detach_quad(quad);
+        }
+        auto tile_collision = m_colliders.find(tile_data_index);
+        if (tile_collision != m_colliders.end()
+            && m_merged_colliders.contains(tile_collision->second))
+        {
+            this->split_merged_collider(tile_collision->second);
+            tile_collision = m_colliders.find(tile_data_index);
+        }
+        if (tile_collision != m_colliders.end())
         {
             m_scene.get_scene().remove_collider(tile_collision->second->get_id());
             m_colliders.erase(tile_collision);
         }
 
         // TODO: Clear GameObjects when necessary
-        this->clear_quad(quad);
-        m_positions.erase(tile_index);
+        chunk.release_quad(first_tile_id, chunk_x, chunk_y);
     }
 
     void TileLayer::update_quad(sf::Vertex* quad, uint32_t tile_id) const
@@ -172,15 +333,6 @@ namespace obe::tiles
             = sf::Vector2f(texture_x * tile_width, (texture_y + 1) * tile_height);
     }
 
-    void TileLayer::clear_quad(sf::Vertex* quad)
-    {
-        for (uint8_t i = 0; i < 4; i++)
-        {
-            quad[i].position = sf::Vector2f(0, 0);
-            quad[i].texCoords = sf::Vector2f(0, 0);
-        }
-    }
-
     TileLayer::TileLayer(const TileScene& scene, const std::string& id, int32_t layer,
         int32_t sublayer, uint32_t x, uint32_t y, uint32_t width, uint32_t height,
         std::vector<uint32_t> data, bool visible)
@@ -203,23 +355,37 @@ namespace obe::tiles
 
     void TileLayer::build()
     {
-        m_sublayers_by_tileset.clear();
+        m_chunks.clear();
+        m_chunks_width = (m_width + TileChunk::Size - 1) / TileChunk::Size;
+        m_chunks_height = (m_height + TileChunk::Size - 1) / TileChunk::Size;
+        m_chunks.reserve(m_chunks_width * m_chunks_height);
+        m_tile_sizes.clear();
         for (const uint32_t first_tile_id : m_scene.get_tilesets().get_tilesets_first_tiles_ids())
         {
-            m_sublayers_by_tileset[first_tile_id] = sfe::SpannableVertexArray {};
-            m_sublayers_by_tileset[first_tile_id].setPrimitiveType(sf::Quads);
-            m_sublayers_by_tileset[first_tile_id].resize(m_width * m_height * 4);
+            const Tileset& tileset = m_scene.get_tilesets().tileset_from_tile_id(first_tile_id);
+            const sf::Vector2u tile_size(tileset.get_tile_width(), tileset.get_tile_height());
+            if (std::find(m_tile_sizes.begin(), m_tile_sizes.end(), tile_size)
+                == m_tile_sizes.end())
+            {
+                m_tile_sizes.push_back(tile_size);
+            }
         }
-
-        for (unsigned int x = 0; x < m_width; ++x)
+        for (uint32_t chunk_y = 0; chunk_y < m_chunks_height; ++chunk_y)
         {
-            for (unsigned int y = 0; y < m_height; ++y)
+            for (uint32_t chunk_x = 0; chunk_x < m_chunks_width; ++chunk_x)
             {
-                const uint32_t tile_data_index = x + y * m_width;
-                const uint32_t tile_id = m_data[tile_data_index];
-                build_tile(x, y, tile_id);
+                m_chunks.emplace_back(chunk_x, chunk_y);
             }
         }
+        if (m_scene.is_merging_colliders())
+        {
+            this->build_merged_colliders();
+        }
+
+        for (TileChunk& chunk : m_chunks)
+        {
+            this->build_chunk(chunk);
+        }
     }
 
     void TileLayer::draw(graphics::RenderTarget& surface, const scene::Camera& camera)
@@ -257,29 +423,58 @@ namespace obe::tiles
         }
         states.transform.translate(translate_x, translate_y);
 
-        const transform::UnitVector camera_position = camera.get_position();
-        const int64_t camera_x = (camera_position.x * transform::UnitVector::Screen.h / 2.f);
-        const int64_t camera_width = std::ceil(camera_size.y * transform::UnitVector::Screen.w / 2);
-
-        uint32_t vertex_count = 0;
+        // Area of the layer (in pixels) covered by the screen, the bounding box of the
+        // inverse transform accounts for any zoom or rotation applied to the layer
+        const sf::FloatRect view = states.transform.getInverse().transformRect(sf::FloatRect(
+            0, 0, transform::UnitVector::Screen.w, transform::UnitVector::Screen.h));
 
-        for (auto& [first_tile_id, layer] : m_sublayers_by_tileset)
+        m_drawn_vertex_count = 0;
+        // Chunks of each tileset are filtered again below using the size of its tiles
+        const std::optional<TileRect> visible_chunks
+            = get_chunks_in_area(view, m_tile_sizes, m_chunks_width, m_chunks_height);
+        if (!visible_chunks)
         {
-            const Tileset& tileset = m_scene.get_tilesets().tileset_from_tile_id(first_tile_id);
-            states.texture = &tileset.get_texture().operator const sf::Texture&();
-
-            // Finding out VertexArray rendering span based on camera size and position
-            const uint32_t tileset_tile_width = tileset.get_tile_width();
-            const uint32_t tileset_tile_height = tileset.get_tile_width();
-            const size_t span_start = std::max(
-                0ll, static_cast<long long int>(((camera_x / tileset_tile_width)) * 4 * m_height));
-            const size_t span_end = std::min(layer.getVertexCount(),
-                static_cast<size_t>(
-                    (((camera_x + camera_width) / tileset_tile_width) + 1) * 4 * m_height));
-            layer.setSpan(span_start, span_end);
-
-            // Rendering entire VertexArray
-            surface.draw(layer, states);
+            return;
+        }
+        for (uint32_t chunk_y = visible_chunks->top; chunk_y <= visible_chunks->bottom; ++chunk_y)
+        {
+            for (uint32_t chunk_x = visible_chunks->left; chunk_x <= visible_chunks->right;
+                 ++chunk_x)
+            {
+                const TileChunk& chunk = m_chunks[chunk_x + chunk_y * m_chunks_width];
+                for (const TileChunk::TilesetQuads& quads : chunk.get_quads())
+                {
+                    const Tileset& tileset
+                        = m_scene.get_tilesets().tileset_from_tile_id(quads.first_tile_id);
+                    const std::optional<TileRect> visible_tiles = get_cells_in_area(view,
+                        tileset.get_tile_width(), tileset.get_tile_height(), m_width, m_height);
+                    if (!visible_tiles)
+                    {
+                        continue;
+                    }
+                    const uint32_t chunk_left = chunk_x * TileChunk::Size;
+                    const uint32_t chunk_top = chunk_y * TileChunk::Size;
+                    const uint32_t first_row = std::max(visible_tiles->top, chunk_top);
+                    const uint32_t last_row
+                        = std::min(visible_tiles->bottom, chunk_top + TileChunk::Size - 1);
+                    if (visible_tiles->right < chunk_left
+                        || visible_tiles->left > chunk_left + TileChunk::Size - 1
+                        || first_row > last_row)
+                    {
+                        continue;
+                    }
+
+                    // Quads are stored row by row, the visible rows are contiguous
+                    const std::size_t first_vertex
+                        = (first_row - chunk_top) * TileChunk::Size * 4;
+                    const std::size_t vertex_count
+                        = (last_row - first_row + 1) * TileChunk::Size * 4;
+                    states.texture = &tileset.get_texture().operator const sf::Texture&();
+                    surface.draw(
+                        quads.vertices.data() + first_vertex, vertex_count, sf::Quads, states);
+                    m_drawn_vertex_count += vertex_count;
+                }
+            }
         }
     }
 
@@ -308,4 +503,19 @@ namespace obe::tiles
         const uint32_t tile_data_index = x + y * m_width;
         return m_data[tile_data_index];
     }
+
+    std::size_t TileLayer::get_drawn_vertex_count() const
+    {
+        return m_drawn_vertex_count;
+    }
+
+    std::size_t TileLayer::get_vertex_count() const
+    {
+        std::size_t vertex_count = 0;
+        for (const TileChunk& chunk : m_chunks)
+        {
+            vertex_count += chunk.get_vertex_count();
+        }
+        return vertex_count;
+    }
 }
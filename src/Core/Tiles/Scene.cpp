@@ -6,6 +6,29 @@
 
 namespace obe::tiles
 {
+    void TileScene::build_indexes()
+    {
+        m_animated_tiles_by_id.clear();
+        m_collider_models_by_id.clear();
+        m_game_objects_models_by_id.clear();
+        // First model wins, like the linear scans the indexes replace
+        for (const auto& animation : m_animated_tiles)
+        {
+            m_animated_tiles_by_id.emplace(animation->get_id(), animation.get());
+        }
+        for (const auto& collider : m_collider_models)
+        {
+            m_collider_models_by_id.emplace(
+                static_cast<uint32_t>(std::stoul(collider->get_id())), collider.get());
+        }
+        for (const vili::node& game_object : m_game_objects_models)
+        {
+            const uint32_t tile_id
+                = static_cast<uint32_t>(game_object.at("tileId").as<vili::integer>());
+            m_game_objects_models_by_id[tile_id].push_back(&game_object);
+        }
+    }
+
     void TileScene::build()
     {
         debug::Log->info(
@@ -41,6 +64,10 @@ namespace obe::tiles
         {
             m_smooth = data["smooth"];
         }
+        if (data.contains("mergeColliders"))
+        {
+            m_merge_colliders = data["mergeColliders"];
+        }
 
         const vili::node& tilesets = data["sources"];
         for (const auto& [tileset_id, tileset] : tilesets.items())
@@ -91,7 +118,7 @@ namespace obe::tiles
             }
         }
 
-        AnimatedTiles animations = this->get_animated_tiles();
+        this->build_indexes();
 
         const vili::node& layers = data["layers"];
         for (const auto& [layer_id, layer] : layers.items())
@@ -139,6 +166,10 @@ namespace obe::tiles
         m_layers.clear();
         m_animated_tiles.clear();
         m_collider_models.clear();
+        m_game_objects_models.clear();
+        m_animated_tiles_by_id.clear();
+        m_collider_models_by_id.clear();
+        m_game_objects_models_by_id.clear();
         m_width = 0;
         m_height = 0;
         m_tile_width = 0;
@@ -217,6 +248,27 @@ namespace obe::tiles
         return m_game_objects_models;
     }
 
+    AnimatedTile* TileScene::get_animated_tile(uint32_t tile_id) const
+    {
+        const auto animation = m_animated_tiles_by_id.find(tile_id);
+        return (animation != m_animated_tiles_by_id.end()) ? animation->second : nullptr;
+    }
+
+    collision::ColliderComponent* TileScene::get_collider_model(uint32_t tile_id) const
+    {
+        const auto collider = m_collider_models_by_id.find(tile_id);
+        return (collider != m_collider_models_by_id.end()) ? collider->second : nullptr;
+    }
+
+    const std::vector<const vili::node*>& TileScene::get_tile_game_objects_models(
+        uint32_t tile_id) const
+    {
+        static const std::vector<const vili::node*> no_game_objects;
+        const auto game_objects = m_game_objects_models_by_id.find(tile_id);
+        return (game_objects != m_game_objects_models_by_id.end()) ? game_objects->second
+                                                                   : no_game_objects;
+    }
+
     uint32_t TileScene::get_width() const
     {
         return m_width;
@@ -242,6 +294,11 @@ namespace obe::tiles
         return m_smooth;
     }
 
+    bool TileScene::is_merging_colliders() const
+    {
+        return m_merge_colliders;
+    }
+
     scene::Scene& TileScene::get_scene() const
     {
         return m_scene;
@@ -4,7 +4,7 @@ namespace obe::time
 {
     void Chronometer::start()
     {
-        m_start = epoch();
+        m_start = monotonic();
         m_started = true;
     }
 
@@ -15,13 +15,13 @@ namespace obe::time
 
     void Chronometer::reset()
     {
-        m_start = epoch();
+        m_start = monotonic();
     }
 
     TimeUnit Chronometer::get_elapsed_time() const
     {
         if (m_started)
-            return epoch() - m_start;
+            return monotonic() - m_start;
         return 0;
     }
 
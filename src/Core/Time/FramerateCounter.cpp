@@ -4,19 +4,19 @@ namespace obe::time
 {
     void FramerateCounter::render_tick()
     {
-        if (epoch() - m_last_tick <= 1000)
+        if (now() - m_last_tick <= 1000)
             m_framerate_buffer++;
     }
 
     void FramerateCounter::update_tick()
     {
-        if (epoch() - m_last_tick <= 1000)
+        if (now() - m_last_tick <= 1000)
             m_updates_buffer++;
         else
         {
             m_updates_counter = m_updates_buffer;
             m_updates_buffer = 0;
-            m_last_tick = epoch();
+            m_last_tick = now();
             m_can_update_fps = true;
             m_framerate_counter = m_framerate_buffer;
             m_framerate_buffer = 0;
@@ -6,14 +6,19 @@
 namespace obe::time
 {
     FramerateManager::FramerateManager(system::Window& window)
-        : m_window(window)
-        , m_clock(epoch())
+        : m_window(&window)
+        , m_clock(now())
         , m_current_frame(0)
         , m_frame_progression(0)
         , m_need_to_render(false)
     {
     }
 
+    FramerateManager::FramerateManager()
+        : m_clock(now())
+    {
+    }
+
     void FramerateManager::configure(vili::node& config)
     {
         if (config.contains("framerateTarget"))
@@ -34,19 +39,24 @@ namespace obe::time
             (m_vsync_enabled) ? "enabled" : "disabled",
             (m_sync_update_render) ? "enabled" : "disabled");
 
-        m_window.set_vertical_sync_enabled(m_vsync_enabled);
+        if (m_window)
+            m_window->set_vertical_sync_enabled(m_vsync_enabled);
     }
 
     void FramerateManager::update()
     {
-        const time::TimeUnit since_last_update = epoch() - m_clock;
+        const time::TimeUnit since_last_update = get_next_frame_time() - m_clock;
         const time::TimeUnit expected_frame_time
-            = 1.0 / static_cast<double>(m_framerate_target.value());
-        if (!m_framerate_target || since_last_update > expected_frame_time)
+            = (m_framerate_target) ? 1.0 / static_cast<double>(*m_framerate_target) : 0;
+        // Virtual frames are not tied to the wall clock, waiting for the framerate target
+        // would never end when the virtual step is shorter than a frame
+        if (is_clock_virtual() || since_last_update >= expected_frame_time)
         {
+            // Subsystems read the frame clock through time::now() during the whole frame
+            advance_frame();
             m_need_to_render = true;
-            m_delta_time = epoch() - m_clock;
-            m_clock = epoch();
+            m_delta_time = now() - m_clock;
+            m_clock = now();
         }
         else if (!m_sync_update_render)
         {
@@ -102,7 +112,8 @@ namespace obe::time
     void FramerateManager::set_vsync_enabled(const bool vsync)
     {
         m_vsync_enabled = vsync;
-        m_window.set_vertical_sync_enabled(vsync);
+        if (m_window)
+            m_window->set_vertical_sync_enabled(vsync);
     }
 
     void FramerateManager::set_max_delta_time(double max_delta_time)
@@ -122,7 +133,8 @@ namespace obe::time
 
     void FramerateManager::start()
     {
-        m_clock = epoch();
+        advance_frame();
+        m_clock = now();
     }
 
     void FramerateManager::reset()
@@ -4,9 +4,59 @@
 
 namespace obe::time
 {
+    namespace
+    {
+        // Offset keeps the frame clock continuous when leaving the virtual clock
+        TimeUnit frame_timestamp = monotonic();
+        TimeUnit monotonic_offset = 0;
+        TimeUnit virtual_step = 0;
+        std::uint64_t frame_index = 0;
+    }
+
     TimeUnit epoch()
     {
         return std::chrono::duration<double>(std::chrono::system_clock::now().time_since_epoch())
             .count();
     }
+
+    TimeUnit monotonic()
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    TimeUnit now()
+    {
+        return frame_timestamp;
+    }
+
+    std::uint64_t get_frame_index()
+    {
+        return frame_index;
+    }
+
+    TimeUnit get_next_frame_time()
+    {
+        if (virtual_step > 0)
+            return frame_timestamp + virtual_step;
+        return monotonic() + monotonic_offset;
+    }
+
+    void advance_frame()
+    {
+        frame_timestamp = get_next_frame_time();
+        frame_index++;
+    }
+
+    void set_virtual_clock(TimeUnit step)
+    {
+        if (virtual_step > 0 && step <= 0)
+            monotonic_offset = frame_timestamp - monotonic();
+        virtual_step = (step > 0) ? step : 0;
+    }
+
+    bool is_clock_virtual()
+    {
+        return virtual_step > 0;
+    }
 } // namespace obe::time
@@ -0,0 +1,60 @@
+#include <algorithm>
+
+#include <Utils/ThreadPool.hpp>
+
+namespace obe::utils
+{
+    void ThreadPool::work()
+    {
+        while (true)
+        {
+            std::function<void()> job;
+            {
+                std::unique_lock lock(m_mutex);
+                m_condition.wait(lock, [this]() { return m_stopping || !m_jobs.empty(); });
+                if (m_stopping)
+                {
+                    return;
+                }
+                job = std::move(m_jobs.front());
+                m_jobs.pop_front();
+            }
+            job();
+        }
+    }
+
+    ThreadPool::ThreadPool(std::size_t workers)
+    {
+        workers = std::max<std::size_t>(workers, 1);
+        m_workers.reserve(workers);
+        for (std::size_t i = 0; i < workers; i++)
+        {
+            m_workers.emplace_back([this]() { this->work(); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard lock(m_mutex);
+            m_stopping = true;
+            m_jobs.clear();
+        }
+        m_condition.notify_all();
+        for (std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    std::size_t ThreadPool::default_worker_count()
+    {
+        const std::size_t hardware_threads = std::thread::hardware_concurrency();
+        return (hardware_threads > 1) ? hardware_threads - 1 : 1;
+    }
+
+    std::size_t ThreadPool::get_worker_count() const
+    {
+        return m_workers.size();
+    }
+} // namespace obe::utils
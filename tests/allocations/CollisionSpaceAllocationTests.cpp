@@ -0,0 +1,125 @@
+#include <catch_amalgamated.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+
+#include <Collision/CollisionSpace.hpp>
+#include <Collision/RectangleCollider.hpp>
+
+using namespace obe::collision;
+using obe::transform::UnitVector;
+
+// This executable replaces the global allocator to count heap allocations, it is kept
+// apart from ObEngineTests so the other tests run with the regular allocator
+
+namespace
+{
+    // Counts the heap allocations made while counting is enabled, whatever the thread
+    std::atomic<bool> count_allocations = false;
+    std::atomic<std::size_t> allocation_count = 0;
+
+    void* counted_allocation(std::size_t size)
+    {
+        if (count_allocations)
+            allocation_count++;
+        if (void* memory = std::malloc(size == 0 ? 1 : size))
+            return memory;
+        throw std::bad_alloc();
+    }
+
+    std::vector<std::unique_ptr<RectangleCollider>> make_colliders(
+        std::size_t amount, double world_size, std::mt19937& generator)
+    {
+        std::uniform_real_distribution<double> positions(0, world_size);
+        std::vector<std::unique_ptr<RectangleCollider>> colliders;
+        colliders.reserve(amount);
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            colliders.push_back(std::make_unique<RectangleCollider>(
+                UnitVector(positions(generator), positions(generator)), UnitVector(1, 1)));
+        }
+        return colliders;
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return counted_allocation(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return counted_allocation(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+TEST_CASE("CollisionSpace steady-state queries should not allocate",
+    "[obe.Collision.CollisionSpace]")
+{
+    std::mt19937 generator(42);
+    auto colliders = make_colliders(500, 100, generator);
+    CollisionSpace space;
+    std::vector<CollisionQuery> queries;
+    for (const auto& collider : colliders)
+    {
+        space.add_collider(collider.get());
+        queries.push_back({ collider.get(), UnitVector(3, -2) });
+    }
+    Quadtree quadtree(obe::transform::AABB(UnitVector(0, 0), UnitVector(128, 128)));
+    for (const auto& collider : colliders)
+    {
+        quadtree.add(collider.get(), collider->get_bounding_box());
+    }
+    const obe::transform::AABB query_box(UnitVector(10, 10), UnitVector(30, 30));
+
+    std::vector<const Collider*> query_buffer;
+    std::vector<ReachableCollider> reachable_buffer;
+    std::vector<std::vector<ReachableCollider>> batch_buffer;
+    std::size_t results = 0;
+    const auto run_queries = [&]() {
+        quadtree.query(query_box, query_buffer);
+        results += query_buffer.size();
+        quadtree.visit(query_box, [&results](const Collider*) { results++; });
+        for (const auto& collider : colliders)
+        {
+            results += space.collides(*collider);
+            space.get_reachable_colliders(*collider, UnitVector(3, -2), reachable_buffer);
+            results += reachable_buffer.size();
+            results += space.get_offset_before_collision(*collider, UnitVector(3, -2)).x > 0;
+        }
+        space.get_reachable_colliders(queries, batch_buffer);
+        results += batch_buffer.size();
+    };
+    // The first frame grows the buffers
+    run_queries();
+
+    allocation_count = 0;
+    count_allocations = true;
+    run_queries();
+    run_queries();
+    count_allocations = false;
+    REQUIRE(allocation_count == 0);
+    REQUIRE(results > 0);
+}
@@ -0,0 +1,453 @@
+#include <catch_amalgamated.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <thread>
+
+#include <fmt/format.h>
+
+#include <Collision/CollisionSpace.hpp>
+#include <Collision/RectangleCollider.hpp>
+
+using namespace obe::collision;
+using obe::transform::UnitVector;
+
+namespace
+{
+    std::vector<std::unique_ptr<RectangleCollider>> make_colliders(
+        std::size_t amount, double world_size, std::mt19937& generator)
+    {
+        std::uniform_real_distribution<double> positions(0, world_size);
+        std::vector<std::unique_ptr<RectangleCollider>> colliders;
+        colliders.reserve(amount);
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            colliders.push_back(std::make_unique<RectangleCollider>(
+                UnitVector(positions(generator), positions(generator)), UnitVector(1, 1)));
+        }
+        return colliders;
+    }
+
+    bool brute_force_collides(const std::vector<std::unique_ptr<RectangleCollider>>& colliders,
+        const Collider& collider)
+    {
+        for (const auto& other : colliders)
+        {
+            if (other.get() != &collider && collider.collides(*other))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+TEST_CASE("CollisionSpace should follow moving Colliders", "[obe.Collision.CollisionSpace]")
+{
+    CollisionSpace space;
+    RectangleCollider wall(UnitVector(0, 0), UnitVector(10, 10));
+    RectangleCollider mover(UnitVector(-1000, -1000), UnitVector(1, 1));
+    space.add_collider(&wall);
+    space.add_collider(&mover);
+
+    SECTION("Teleport into another Collider")
+    {
+        REQUIRE_FALSE(space.collides(mover));
+        mover.set_position(UnitVector(5, 5));
+        REQUIRE(space.collides(mover));
+        REQUIRE(space.collides(wall));
+    }
+    SECTION("Fast mover crossing the whole space between two queries")
+    {
+        wall.set_position(UnitVector(5000000, -3000000));
+        mover.move(UnitVector(5001000, -2999000));
+        REQUIRE(space.collides(mover));
+        wall.move(UnitVector(-10000000, 6000000));
+        REQUIRE_FALSE(space.collides(mover));
+        REQUIRE_FALSE(space.collides(wall));
+    }
+    SECTION("Removal after a move")
+    {
+        mover.set_position(UnitVector(5, 5));
+        space.remove_collider(&mover);
+        REQUIRE(space.get_collider_amount() == 1);
+        REQUIRE_FALSE(space.collides(wall));
+        mover.move(UnitVector(1, 1));
+        REQUIRE_FALSE(space.collides(wall));
+    }
+    SECTION("Destroyed Colliders leave the CollisionSpace")
+    {
+        {
+            RectangleCollider temporary(UnitVector(2, 2), UnitVector(1, 1));
+            space.add_collider(&temporary);
+            temporary.move(UnitVector(1, 1));
+            REQUIRE(space.get_collider_amount() == 3);
+        }
+        REQUIRE(space.get_collider_amount() == 2);
+        REQUIRE_FALSE(space.collides(wall));
+    }
+    SECTION("Copies are not part of the CollisionSpace")
+    {
+        RectangleCollider copy(mover);
+        copy.set_position(UnitVector(5, 5));
+        REQUIRE(space.get_collider_amount() == 2);
+        REQUIRE(space.collides(copy));
+        REQUIRE_FALSE(space.collides(mover));
+    }
+}
+
+TEST_CASE("CollisionSpace should fit its Quadtree around its Colliders",
+    "[obe.Collision.CollisionSpace]")
+{
+    std::mt19937 generator(3);
+    auto colliders = make_colliders(1000, 100, generator);
+    CollisionSpace space;
+    for (const auto& collider : colliders)
+    {
+        space.add_collider(collider.get());
+    }
+    space.refresh_quadtree();
+    const obe::transform::AABB level = space.get_bounds();
+    for (const auto& collider : colliders)
+    {
+        REQUIRE(level.contains(collider->get_bounding_box()));
+    }
+    CHECK(level.width() < 1000);
+
+    // Partitioning happens at level scale instead of piling everything in one leaf
+    const QuadtreeStats stats = space.get_quadtree_stats();
+    CHECK(stats.values == colliders.size());
+    CHECK(stats.depth > 0);
+    CHECK(stats.max_leaf_values <= space.get_quadtree_threshold());
+
+    SECTION("Growing when a Collider leaves")
+    {
+        RectangleCollider& runaway = *colliders.front();
+        runaway.set_position(UnitVector(100000, -50000));
+        CHECK_FALSE(space.collides(runaway));
+        REQUIRE(space.get_bounds().contains(runaway.get_bounding_box()));
+        RectangleCollider probe(UnitVector(100000, -50000), UnitVector(1, 1));
+        CHECK(space.collides(probe));
+        CHECK(space.get_quadtree_stats().values == colliders.size());
+
+        space.remove_collider(&runaway);
+        space.refresh_quadtree();
+        CHECK(space.get_bounds().width() < 1000);
+    }
+    SECTION("Growing when a Collider is added outside")
+    {
+        RectangleCollider far(UnitVector(-20000, 30000), UnitVector(1, 1));
+        space.add_collider(&far);
+        REQUIRE(space.get_bounds().contains(far.get_bounding_box()));
+        RectangleCollider probe(UnitVector(-20000, 30000), UnitVector(1, 1));
+        CHECK(space.collides(probe));
+    }
+}
+
+TEST_CASE("CollisionSpace should match brute force after random moves",
+    "[obe.Collision.CollisionSpace]")
+{
+    std::mt19937 generator(42);
+    auto colliders = make_colliders(2000, 200, generator);
+    CollisionSpace space;
+    for (const auto& collider : colliders)
+    {
+        space.add_collider(collider.get());
+    }
+
+    std::uniform_real_distribution<double> small_steps(-2, 2);
+    std::uniform_real_distribution<double> teleports(-50000, 50000);
+    std::uniform_int_distribution<std::size_t> picker(0, colliders.size() - 1);
+    for (std::size_t frame = 0; frame < 20; frame++)
+    {
+        for (const auto& collider : colliders)
+        {
+            collider->move(UnitVector(small_steps(generator), small_steps(generator)));
+        }
+        for (std::size_t i = 0; i < 20; i++)
+        {
+            RectangleCollider& collider = *colliders[picker(generator)];
+            collider.move(UnitVector(teleports(generator), teleports(generator)));
+        }
+        if (frame % 2)
+        {
+            space.update();
+        }
+        for (std::size_t i = 0; i < 100; i++)
+        {
+            const RectangleCollider& collider = *colliders[picker(generator)];
+            REQUIRE(space.collides(collider) == brute_force_collides(colliders, collider));
+        }
+    }
+}
+
+TEST_CASE("CollisionSpace moving bodies per-frame cost",
+    "[.][benchmark][obe.Collision.CollisionSpace]")
+{
+    for (const std::size_t amount : { 1000, 10000 })
+    {
+        std::mt19937 generator(42);
+        auto colliders = make_colliders(amount, 1000, generator);
+        CollisionSpace space;
+        for (const auto& collider : colliders)
+        {
+            space.add_collider(collider.get());
+        }
+        std::uniform_real_distribution<double> steps(-1, 1);
+        std::vector<UnitVector> offsets;
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            offsets.emplace_back(steps(generator), steps(generator));
+        }
+
+        BENCHMARK(fmt::format("Rebuild the Quadtree every frame ({} moving Colliders)", amount))
+        {
+            for (std::size_t i = 0; i < amount; i++)
+            {
+                colliders[i]->move(offsets[i]);
+                offsets[i] = offsets[i] * -1.0;
+            }
+            space.refresh_quadtree();
+            return space.collides(*colliders.front());
+        };
+        BENCHMARK(fmt::format("Reinsert moved Colliders ({} moving Colliders)", amount))
+        {
+            for (std::size_t i = 0; i < amount; i++)
+            {
+                colliders[i]->move(offsets[i]);
+                offsets[i] = offsets[i] * -1.0;
+            }
+            space.update();
+            return space.collides(*colliders.front());
+        };
+        BENCHMARK(fmt::format("Reinsert moved Colliders, 10% moving ({} Colliders)", amount))
+        {
+            for (std::size_t i = 0; i < amount; i += 10)
+            {
+                colliders[i]->move(offsets[i]);
+                offsets[i] = offsets[i] * -1.0;
+            }
+            space.update();
+            return space.collides(*colliders.front());
+        };
+    }
+}
+
+TEST_CASE("CollisionSpace should find all colliding pairs at once",
+    "[obe.Collision.CollisionSpace]")
+{
+    CollisionSpace space;
+    RectangleCollider first(UnitVector(0, 0), UnitVector(10, 10));
+    RectangleCollider second(UnitVector(5, 5), UnitVector(10, 10));
+    RectangleCollider third(UnitVector(100, 100), UnitVector(10, 10));
+    second.set_tag("ghost");
+    for (const Collider* collider : { &first, &second, &third })
+    {
+        space.add_collider(collider);
+    }
+    const auto ordered = [](const Collider* collider1, const Collider* collider2) {
+        return std::less<const Collider*>()(collider1, collider2)
+            ? CollisionPair(collider1, collider2)
+            : CollisionPair(collider2, collider1);
+    };
+
+    SECTION("Pairs")
+    {
+        REQUIRE(space.get_all_collisions() == std::vector { ordered(&first, &second) });
+        third.set_position(UnitVector(12, 12));
+        const auto collisions = space.get_all_collisions();
+        REQUIRE(collisions.size() == 2);
+        REQUIRE(std::is_sorted(collisions.begin(), collisions.end()));
+    }
+    SECTION("Blacklisted tags are skipped")
+    {
+        space.add_tag_to_blacklist("ghost", "");
+        REQUIRE(space.get_all_collisions().empty());
+    }
+    SECTION("Contacts")
+    {
+        ContactChanges changes = space.update_contacts();
+        REQUIRE(changes.began == std::vector { ordered(&first, &second) });
+        REQUIRE(changes.stayed.empty());
+        REQUIRE(changes.ended.empty());
+
+        third.set_position(UnitVector(-8, -8));
+        changes = space.update_contacts();
+        REQUIRE(changes.began == std::vector { ordered(&first, &third) });
+        REQUIRE(changes.stayed == std::vector { ordered(&first, &second) });
+        REQUIRE(changes.ended.empty());
+
+        second.move(UnitVector(1000, 0));
+        changes = space.update_contacts();
+        REQUIRE(changes.began.empty());
+        REQUIRE(changes.stayed == std::vector { ordered(&first, &third) });
+        REQUIRE(changes.ended == std::vector { ordered(&first, &second) });
+
+        space.remove_collider(&third);
+        changes = space.update_contacts();
+        REQUIRE(changes.began.empty());
+        REQUIRE(changes.stayed.empty());
+        REQUIRE(changes.ended.empty());
+    }
+    SECTION("Reset contacts")
+    {
+        // Contacts stop being updated while nobody listens to them, then start again
+        space.update_contacts();
+        space.reset_contacts();
+        second.move(UnitVector(1000, 0));
+        third.set_position(UnitVector(-8, -8));
+        space.update();
+        second.move(UnitVector(-1000, 0));
+        space.update();
+        const ContactChanges changes = space.update_contacts();
+        // first and second separated and touched again, nothing ends from before the reset
+        REQUIRE(changes.began.size() == 2);
+        REQUIRE(std::is_sorted(changes.began.begin(), changes.began.end()));
+        REQUIRE(std::find(changes.began.begin(), changes.began.end(), ordered(&first, &second))
+            != changes.began.end());
+        REQUIRE(changes.stayed.empty());
+        REQUIRE(changes.ended.empty());
+
+        // Pairs that separated while contacts were not updated never end
+        space.reset_contacts();
+        third.set_position(UnitVector(100, 100));
+        space.update();
+        REQUIRE(space.update_contacts().ended.empty());
+    }
+}
+
+TEST_CASE("Collider tags should be interned", "[obe.Collision.CollisionSpace]")
+{
+    RectangleCollider collider;
+    REQUIRE(collider.get_tag_id() == 0);
+    REQUIRE(collider.get_tag().empty());
+    collider.set_tag("player");
+    REQUIRE(collider.get_tag() == "player");
+    REQUIRE(collider.get_tag_id() == ColliderTags::get_id("player"));
+    REQUIRE(ColliderTags::get_name(collider.get_tag_id()) == "player");
+    REQUIRE(ColliderTags::get_id("player") != ColliderTags::get_id("enemy"));
+    RectangleCollider copy(collider);
+    REQUIRE(copy.get_tag_id() == collider.get_tag_id());
+}
+
+TEST_CASE("CollisionSpace should filter pairs with tag blacklists",
+    "[obe.Collision.CollisionSpace]")
+{
+    CollisionSpace space;
+    RectangleCollider source(UnitVector(0, 0), UnitVector(10, 10));
+    RectangleCollider target(UnitVector(5, 5), UnitVector(10, 10));
+    space.add_collider(&source);
+    space.add_collider(&target);
+    source.set_tag("source");
+    // Go past the first 64 tag ids so the bitsets need more than one word
+    for (std::size_t i = 0; i < 100; i++)
+    {
+        target.set_tag(fmt::format("target_{}", i));
+    }
+
+    REQUIRE(space.collides(source));
+    space.add_tag_to_blacklist("source", target.get_tag());
+    REQUIRE(space.get_blacklist("source").contains(target.get_tag()));
+    REQUIRE_FALSE(space.collides(source));
+    REQUIRE_FALSE(space.collides(target));
+    REQUIRE(space.get_all_collisions().empty());
+
+    space.remove_tag_to_blacklist("source", target.get_tag());
+    REQUIRE(space.collides(source));
+
+    space.add_tag_to_blacklist(target.get_tag(), "source");
+    REQUIRE_FALSE(space.collides(source));
+    space.add_tag_to_blacklist(target.get_tag(), "other");
+    space.clear_blacklist(target.get_tag());
+    REQUIRE(space.get_blacklist(target.get_tag()).empty());
+    REQUIRE(space.collides(source));
+}
+
+TEST_CASE("CollisionSpace batched pair query cost", "[.][benchmark][obe.Collision.CollisionSpace]")
+{
+    for (const std::size_t amount : { 1000, 4000 })
+    {
+        std::mt19937 generator(42);
+        auto colliders = make_colliders(amount, std::sqrt(amount) * 5, generator);
+        CollisionSpace space;
+        for (const auto& collider : colliders)
+        {
+            space.add_collider(collider.get());
+        }
+
+        BENCHMARK(fmt::format("One collides() query per Collider ({} Colliders)", amount))
+        {
+            std::size_t colliding = 0;
+            for (const auto& collider : colliders)
+            {
+                colliding += space.collides(*collider);
+            }
+            return colliding;
+        };
+        BENCHMARK(fmt::format("get_all_collisions ({} Colliders)", amount))
+        {
+            return space.get_all_collisions().size();
+        };
+    }
+}
+
+TEST_CASE("CollisionSpace batched queries should not depend on the narrowphase workers",
+    "[obe.Collision.CollisionSpace]")
+{
+    std::mt19937 generator(42);
+    auto colliders = make_colliders(1000, 150, generator);
+    CollisionSpace space;
+    std::vector<CollisionQuery> queries;
+    std::uniform_real_distribution<double> offsets(-10, 10);
+    for (const auto& collider : colliders)
+    {
+        space.add_collider(collider.get());
+        queries.push_back({ collider.get(), UnitVector(offsets(generator), offsets(generator)) });
+    }
+
+    const auto serial_collisions = space.get_all_collisions();
+    const auto serial_reachable = space.get_reachable_colliders(queries);
+    REQUIRE_FALSE(serial_collisions.empty());
+    REQUIRE(serial_reachable[0] == space.get_reachable_colliders(*colliders[0], queries[0].offset));
+
+    space.set_narrowphase_workers(3);
+    REQUIRE(space.get_narrowphase_workers() == 3);
+    for (std::size_t i = 0; i < 3; i++)
+    {
+        REQUIRE(space.get_all_collisions() == serial_collisions);
+        REQUIRE(space.get_reachable_colliders(queries) == serial_reachable);
+    }
+    space.set_narrowphase_workers(0);
+    REQUIRE(space.get_narrowphase_workers() == 0);
+}
+
+TEST_CASE("CollisionSpace narrowphase scaling", "[.][benchmark][obe.Collision.CollisionSpace]")
+{
+    std::mt19937 generator(42);
+    auto colliders = make_colliders(4000, 400, generator);
+    CollisionSpace space;
+    std::vector<CollisionQuery> queries;
+    std::uniform_real_distribution<double> offsets(-20, 20);
+    for (const auto& collider : colliders)
+    {
+        space.add_collider(collider.get());
+        queries.push_back({ collider.get(), UnitVector(offsets(generator), offsets(generator)) });
+    }
+
+    const std::size_t max_workers = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    for (std::size_t workers = 0; workers < max_workers;
+         workers = std::max<std::size_t>(workers * 2, 1))
+    {
+        space.set_narrowphase_workers(workers);
+        BENCHMARK(fmt::format("Batched get_reachable_colliders ({} workers)", workers))
+        {
+            return space.get_reachable_colliders(queries).size();
+        };
+        BENCHMARK(fmt::format("get_all_collisions ({} workers)", workers))
+        {
+            return space.get_all_collisions().size();
+        };
+    }
+}
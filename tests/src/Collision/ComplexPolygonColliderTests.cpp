@@ -0,0 +1,128 @@
+#include <catch_amalgamated.hpp>
+
+#include <cmath>
+#include <numbers>
+
+#include <Collision/CircleCollider.hpp>
+#include <Collision/CollisionSpace.hpp>
+#include <Collision/ComplexPolygonCollider.hpp>
+#include <Collision/RectangleCollider.hpp>
+
+using namespace obe::collision;
+using obe::transform::UnitVector;
+
+namespace
+{
+    // L-shaped polygon, the notch between its two arms spans from (2, 0) to (4, 2)
+    ComplexPolygonCollider make_l_shape()
+    {
+        ComplexPolygonCollider polygon;
+        polygon.add_point(UnitVector(0, 0));
+        polygon.add_point(UnitVector(2, 0));
+        polygon.add_point(UnitVector(2, 2));
+        polygon.add_point(UnitVector(4, 2));
+        polygon.add_point(UnitVector(4, 4));
+        polygon.add_point(UnitVector(0, 4));
+        return polygon;
+    }
+}
+
+TEST_CASE("ComplexPolygonCollider should be decomposed into convex pieces",
+    "[obe.Collision.ComplexPolygonCollider]")
+{
+    SECTION("Concave polygon")
+    {
+        const ComplexPolygonCollider polygon = make_l_shape();
+        CHECK(polygon.get_points_amount() == 6);
+        CHECK(polygon.get_pieces_amount() == 2);
+    }
+    SECTION("Convex polygon with more points than cute_c2 supports")
+    {
+        ComplexPolygonCollider polygon;
+        for (int i = 0; i < 20; i++)
+        {
+            const double angle = 2 * std::numbers::pi * i / 20;
+            polygon.add_point(UnitVector(std::cos(angle), std::sin(angle)));
+        }
+        CHECK(polygon.get_pieces_amount() > 1);
+        CHECK(polygon.get_pieces_amount() < 18);
+        RectangleCollider center(UnitVector(-0.1, -0.1), UnitVector(0.2, 0.2));
+        CHECK(polygon.collides(center));
+    }
+    SECTION("Clockwise points")
+    {
+        ComplexPolygonCollider polygon;
+        polygon.add_point(UnitVector(0, 0));
+        polygon.add_point(UnitVector(0, 4));
+        polygon.add_point(UnitVector(4, 4));
+        polygon.add_point(UnitVector(4, 2));
+        polygon.add_point(UnitVector(2, 2));
+        polygon.add_point(UnitVector(2, 0));
+        CHECK(polygon.get_pieces_amount() >= 2);
+        CHECK_FALSE(polygon.collides(RectangleCollider(UnitVector(2.5, 0.5), UnitVector(1, 1))));
+        CHECK(polygon.collides(RectangleCollider(UnitVector(3, 3), UnitVector(0.5, 0.5))));
+    }
+}
+
+TEST_CASE("ComplexPolygonCollider should collide with every Collider type",
+    "[obe.Collision.ComplexPolygonCollider]")
+{
+    const ComplexPolygonCollider polygon = make_l_shape();
+    RectangleCollider in_notch(UnitVector(2.5, 0.5), UnitVector(1, 1));
+    RectangleCollider in_arm(UnitVector(0.5, 0.5), UnitVector(1, 1));
+    CHECK_FALSE(polygon.collides(in_notch));
+    CHECK_FALSE(in_notch.collides(polygon));
+    CHECK(polygon.collides(in_arm));
+    CHECK(in_arm.collides(polygon));
+
+    CircleCollider circle;
+    circle.set_radius(0.4);
+    circle.set_position(UnitVector(3, 1));
+    CHECK_FALSE(polygon.collides(circle));
+    circle.set_position(UnitVector(3, 3));
+    CHECK(circle.collides(polygon));
+
+    ComplexPolygonCollider other = make_l_shape();
+    // Bounding boxes overlap but the lower arm of other fits in the notch
+    other.set_position(UnitVector(2.1, -2.1));
+    CHECK_FALSE(polygon.collides(other));
+    other.set_position(UnitVector(1, 1));
+    CHECK(polygon.collides(other));
+
+    // Moving into the notch is free, moving into the lower arm is blocked halfway
+    RectangleCollider mover(UnitVector(2.5, -2), UnitVector(1, 1));
+    const UnitVector down = mover.get_offset_before_collision(polygon, UnitVector(0, 2));
+    CHECK(down.y == Catch::Approx(2));
+    const UnitVector left_mover
+        = RectangleCollider(UnitVector(6, 2.5), UnitVector(1, 1))
+              .get_offset_before_collision(polygon, UnitVector(-4, 0));
+    CHECK(left_mover.x == Catch::Approx(-2).margin(0.01));
+}
+
+TEST_CASE("ComplexPolygonCollider should cache its bounding box",
+    "[obe.Collision.ComplexPolygonCollider]")
+{
+    ComplexPolygonCollider polygon = make_l_shape();
+    obe::transform::AABB box = polygon.get_bounding_box();
+    CHECK(box.x() == 0);
+    CHECK(box.y() == 0);
+    CHECK(box.width() == 4);
+    CHECK(box.height() == 4);
+
+    polygon.move(UnitVector(10, 20));
+    box = polygon.get_bounding_box();
+    CHECK(box.x() == Catch::Approx(10));
+    CHECK(box.y() == Catch::Approx(20));
+    CHECK(box.width() == Catch::Approx(4));
+
+    RectangleCollider in_arm(UnitVector(10.5, 20.5), UnitVector(1, 1));
+    CHECK(polygon.collides(in_arm));
+
+    CollisionSpace space;
+    space.add_collider(&polygon);
+    space.add_collider(&in_arm);
+    CHECK(space.collides(in_arm));
+    polygon.add_point(UnitVector(-10, 24));
+    CHECK(space.get_bounds().contains(polygon.get_bounding_box()));
+    CHECK(polygon.get_bounding_box().x() == Catch::Approx(-10));
+}
@@ -0,0 +1,326 @@
+#include <catch_amalgamated.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <random>
+
+#include <fmt/format.h>
+
+#include <Collision/CollisionSpace.hpp>
+#include <Collision/Exceptions.hpp>
+#include <Collision/Quadtree.hpp>
+#include <Collision/RectangleCollider.hpp>
+
+using namespace obe::collision;
+using obe::transform::AABB;
+using obe::transform::UnitVector;
+
+namespace
+{
+    constexpr double WORLD_SIZE = 1024;
+
+    std::vector<std::unique_ptr<RectangleCollider>> make_boxes(
+        std::size_t amount, std::mt19937& generator)
+    {
+        std::uniform_real_distribution<double> positions(0, WORLD_SIZE - 8);
+        std::uniform_real_distribution<double> sizes(0.5, 8);
+        std::vector<std::unique_ptr<RectangleCollider>> colliders;
+        colliders.reserve(amount);
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            colliders.push_back(std::make_unique<RectangleCollider>(
+                UnitVector(positions(generator), positions(generator)),
+                UnitVector(sizes(generator), sizes(generator))));
+        }
+        return colliders;
+    }
+
+    std::vector<const Collider*> sorted(std::vector<const Collider*> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+
+    /**
+     * \brief Quadtree allocating each node on its own, as it was before nodes were
+     *        pooled, kept to compare throughput against
+     */
+    class PointerQuadtree
+    {
+    private:
+        struct Entry
+        {
+            const Collider* value;
+            AABB box;
+        };
+
+        struct Node
+        {
+            std::array<std::unique_ptr<Node>, 4> children;
+            std::vector<Entry> values;
+        };
+
+        AABB m_box;
+        std::unique_ptr<Node> m_root = std::make_unique<Node>();
+
+        static AABB child_box(const AABB& box, int i)
+        {
+            const UnitVector half = box.get_size() / 2.0;
+            const UnitVector origin = box.get_position()
+                + UnitVector((i % 2) * half.x, static_cast<double>(i / 2) * half.y);
+            return AABB(origin, half);
+        }
+
+        static int quadrant(const AABB& node_box, const AABB& value_box)
+        {
+            for (int i = 0; i < 4; i++)
+            {
+                if (child_box(node_box, i).contains(value_box))
+                    return i;
+            }
+            return -1;
+        }
+
+        void add(Node* node, std::size_t depth, const AABB& box, const Entry& entry)
+        {
+            if (!node->children[0])
+            {
+                if (depth >= Quadtree::DefaultMaxDepth
+                    || node->values.size() < Quadtree::DefaultThreshold)
+                {
+                    node->values.push_back(entry);
+                    return;
+                }
+                for (auto& child : node->children)
+                    child = std::make_unique<Node>();
+                std::vector<Entry> kept;
+                for (const Entry& value : node->values)
+                {
+                    const int i = quadrant(box, value.box);
+                    if (i != -1)
+                        node->children[i]->values.push_back(value);
+                    else
+                        kept.push_back(value);
+                }
+                node->values = std::move(kept);
+            }
+            const int i = quadrant(box, entry.box);
+            if (i != -1)
+                add(node->children[i].get(), depth + 1, child_box(box, i), entry);
+            else
+                node->values.push_back(entry);
+        }
+
+        bool remove(Node* node, const AABB& box, const Entry& entry)
+        {
+            const int i = node->children[0] ? quadrant(box, entry.box) : -1;
+            if (i == -1)
+            {
+                auto it = std::find_if(node->values.begin(), node->values.end(),
+                    [&entry](const Entry& value) { return value.value == entry.value; });
+                *it = node->values.back();
+                node->values.pop_back();
+                return !node->children[0];
+            }
+            if (!remove(node->children[i].get(), child_box(box, i), entry))
+                return false;
+            std::size_t amount = node->values.size();
+            for (const auto& child : node->children)
+            {
+                if (child->children[0])
+                    return false;
+                amount += child->values.size();
+            }
+            if (amount > Quadtree::DefaultThreshold)
+                return false;
+            for (auto& child : node->children)
+            {
+                node->values.insert(
+                    node->values.end(), child->values.begin(), child->values.end());
+                child.reset();
+            }
+            return true;
+        }
+
+        void query(const Node* node, const AABB& box, const AABB& query_box,
+            std::vector<const Collider*>& values) const
+        {
+            for (const Entry& entry : node->values)
+            {
+                if (query_box.intersects(entry.box))
+                    values.push_back(entry.value);
+            }
+            if (node->children[0])
+            {
+                for (int i = 0; i < 4; i++)
+                {
+                    const AABB box_i = child_box(box, i);
+                    if (query_box.intersects(box_i))
+                        query(node->children[i].get(), box_i, query_box, values);
+                }
+            }
+        }
+
+    public:
+        explicit PointerQuadtree(const AABB& box)
+            : m_box(box)
+        {
+        }
+
+        void add(const Collider* value, const AABB& box)
+        {
+            add(m_root.get(), 0, m_box, Entry { value, box });
+        }
+
+        void remove(const Collider* value, const AABB& box)
+        {
+            remove(m_root.get(), m_box, Entry { value, box });
+        }
+
+        void query(const AABB& box, std::vector<const Collider*>& values) const
+        {
+            values.clear();
+            query(m_root.get(), m_box, box, values);
+        }
+    };
+}
+
+TEST_CASE("Quadtree should match brute force after inserts and removals",
+    "[obe.Collision.Quadtree]")
+{
+    std::mt19937 generator(7);
+    auto colliders = make_boxes(2000, generator);
+    Quadtree quadtree(AABB(UnitVector(0, 0), UnitVector(WORLD_SIZE, WORLD_SIZE)), 4, 6);
+    CHECK(quadtree.get_threshold() == 4);
+    CHECK(quadtree.get_max_depth() == 6);
+
+    std::vector<bool> inserted(colliders.size(), false);
+    std::uniform_int_distribution<std::size_t> picks(0, colliders.size() - 1);
+    std::uniform_real_distribution<double> positions(0, WORLD_SIZE - 64);
+    std::vector<const Collider*> found;
+    // Interleave inserts and removals so split nodes get merged and reused
+    for (int round = 0; round < 20; round++)
+    {
+        for (int i = 0; i < 500; i++)
+        {
+            const std::size_t index = picks(generator);
+            const RectangleCollider& collider = *colliders[index];
+            if (inserted[index])
+                quadtree.remove(&collider, collider.get_bounding_box());
+            else
+                quadtree.add(&collider, collider.get_bounding_box());
+            inserted[index] = !inserted[index];
+        }
+        const AABB query_box(
+            UnitVector(positions(generator), positions(generator)), UnitVector(64, 64));
+        std::vector<const Collider*> expected;
+        for (std::size_t i = 0; i < colliders.size(); i++)
+        {
+            if (inserted[i] && query_box.intersects(colliders[i]->get_bounding_box()))
+                expected.push_back(colliders[i].get());
+        }
+        quadtree.query(query_box, found);
+        REQUIRE(sorted(found) == sorted(expected));
+    }
+
+    std::size_t expected_pairs = 0;
+    for (std::size_t i = 0; i < colliders.size(); i++)
+    {
+        for (std::size_t j = 0; j < i; j++)
+        {
+            if (inserted[i] && inserted[j]
+                && colliders[i]->get_bounding_box().intersects(colliders[j]->get_bounding_box()))
+                expected_pairs++;
+        }
+    }
+    CHECK(quadtree.find_all_intersections().size() == expected_pairs);
+
+    quadtree.clear();
+    quadtree.query(AABB(UnitVector(0, 0), UnitVector(WORLD_SIZE, WORLD_SIZE)), found);
+    CHECK(found.empty());
+}
+
+TEST_CASE("CollisionSpace Quadtree limits should be tunable", "[obe.Collision.Quadtree]")
+{
+    std::mt19937 generator(11);
+    auto colliders = make_boxes(500, generator);
+    CollisionSpace space;
+    for (const auto& collider : colliders)
+    {
+        space.add_collider(collider.get());
+    }
+    const auto before = space.get_all_collisions();
+
+    space.set_quadtree_limits(2, 12);
+    CHECK(space.get_quadtree_threshold() == 2);
+    CHECK(space.get_quadtree_max_depth() == 12);
+    CHECK(space.get_all_collisions() == before);
+    CHECK_THROWS_AS(space.set_quadtree_limits(0, 8), exceptions::InvalidQuadtreeThreshold);
+}
+
+TEST_CASE("Quadtree pooled nodes throughput", "[.][benchmark][obe.Collision.Quadtree]")
+{
+    for (const std::size_t amount : { 1000, 10000 })
+    {
+        std::mt19937 generator(42);
+        auto colliders = make_boxes(amount, generator);
+        std::vector<AABB> boxes;
+        for (const auto& collider : colliders)
+        {
+            boxes.push_back(collider->get_bounding_box());
+        }
+        const AABB world(UnitVector(0, 0), UnitVector(WORLD_SIZE, WORLD_SIZE));
+        std::uniform_real_distribution<double> positions(0, WORLD_SIZE - 32);
+        std::vector<AABB> query_boxes;
+        for (std::size_t i = 0; i < 1000; i++)
+        {
+            query_boxes.emplace_back(
+                UnitVector(positions(generator), positions(generator)), UnitVector(32, 32));
+        }
+        std::vector<const Collider*> found;
+
+        Quadtree pooled(world);
+        PointerQuadtree pointers(world);
+        BENCHMARK(fmt::format("Pooled nodes: insert then remove ({} Colliders)", amount))
+        {
+            for (std::size_t i = 0; i < amount; i++)
+                pooled.add(colliders[i].get(), boxes[i]);
+            for (std::size_t i = 0; i < amount; i++)
+                pooled.remove(colliders[i].get(), boxes[i]);
+        };
+        BENCHMARK(fmt::format("Pointer nodes: insert then remove ({} Colliders)", amount))
+        {
+            for (std::size_t i = 0; i < amount; i++)
+                pointers.add(colliders[i].get(), boxes[i]);
+            for (std::size_t i = 0; i < amount; i++)
+                pointers.remove(colliders[i].get(), boxes[i]);
+        };
+
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            pooled.add(colliders[i].get(), boxes[i]);
+            pointers.add(colliders[i].get(), boxes[i]);
+        }
+        BENCHMARK(fmt::format("Pooled nodes: 1000 queries ({} Colliders)", amount))
+        {
+            std::size_t total = 0;
+            for (const AABB& box : query_boxes)
+            {
+                pooled.query(box, found);
+                total += found.size();
+            }
+            return total;
+        };
+        BENCHMARK(fmt::format("Pointer nodes: 1000 queries ({} Colliders)", amount))
+        {
+            std::size_t total = 0;
+            for (const AABB& box : query_boxes)
+            {
+                pointers.query(box, found);
+                total += found.size();
+            }
+            return total;
+        };
+    }
+}
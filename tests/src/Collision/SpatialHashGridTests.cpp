@@ -0,0 +1,219 @@
+#include <catch_amalgamated.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+#include <fmt/format.h>
+
+#include <Collision/CollisionSpace.hpp>
+#include <Collision/Exceptions.hpp>
+#include <Collision/RectangleCollider.hpp>
+#include <Collision/SpatialHashGrid.hpp>
+
+using namespace obe::collision;
+using obe::transform::AABB;
+using obe::transform::UnitVector;
+
+namespace
+{
+    using Colliders = std::vector<std::unique_ptr<RectangleCollider>>;
+
+    Colliders make_uniform(std::size_t amount, double world_size, std::mt19937& generator)
+    {
+        std::uniform_real_distribution<double> positions(0, world_size);
+        Colliders colliders;
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            colliders.push_back(std::make_unique<RectangleCollider>(
+                UnitVector(positions(generator), positions(generator)), UnitVector(1, 1)));
+        }
+        return colliders;
+    }
+
+    Colliders make_clustered(std::size_t amount, double world_size, std::mt19937& generator)
+    {
+        std::uniform_real_distribution<double> centers(0, world_size);
+        std::normal_distribution<double> spread(0, world_size / 100);
+        std::vector<UnitVector> clusters;
+        for (std::size_t i = 0; i < 8; i++)
+        {
+            clusters.emplace_back(centers(generator), centers(generator));
+        }
+        Colliders colliders;
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            const UnitVector& cluster = clusters[i % clusters.size()];
+            colliders.push_back(std::make_unique<RectangleCollider>(
+                UnitVector(cluster.x + spread(generator), cluster.y + spread(generator)),
+                UnitVector(1, 1)));
+        }
+        return colliders;
+    }
+
+    std::vector<CollisionPair> normalized(
+        std::vector<std::pair<const Collider*, const Collider*>> pairs)
+    {
+        for (auto& [first, second] : pairs)
+        {
+            if (second < first)
+                std::swap(first, second);
+        }
+        std::sort(pairs.begin(), pairs.end());
+        return pairs;
+    }
+}
+
+TEST_CASE("SpatialHashGrid should match brute force", "[obe.Collision.SpatialHashGrid]")
+{
+    std::mt19937 generator(5);
+    std::uniform_real_distribution<double> positions(-50, 50);
+    std::uniform_real_distribution<double> sizes(0.1, 4);
+    Colliders colliders;
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        colliders.push_back(std::make_unique<RectangleCollider>(
+            UnitVector(positions(generator), positions(generator)),
+            UnitVector(sizes(generator), sizes(generator))));
+    }
+    // Larger than MaxCellsPerValue cells, kept aside by the grid
+    colliders.push_back(
+        std::make_unique<RectangleCollider>(UnitVector(-20, -20), UnitVector(30, 10)));
+    colliders.push_back(
+        std::make_unique<RectangleCollider>(UnitVector(0, -40), UnitVector(12, 70)));
+
+    SpatialHashGrid grid(2);
+    CHECK(grid.get_cell_size() == 2);
+    std::vector<bool> inserted(colliders.size(), false);
+    for (std::size_t i = 0; i < colliders.size(); i += 2)
+    {
+        grid.add(colliders[i].get(), colliders[i]->get_bounding_box());
+        inserted[i] = true;
+    }
+    for (std::size_t i = 0; i < colliders.size(); i += 6)
+    {
+        grid.remove(colliders[i].get(), colliders[i]->get_bounding_box());
+        inserted[i] = false;
+    }
+
+    std::vector<const Collider*> found;
+    for (const AABB& query_box : { AABB(UnitVector(-10, -10), UnitVector(8, 8)),
+             AABB(UnitVector(-45, 30), UnitVector(1, 1)),
+             AABB(UnitVector(-1000, -1000), UnitVector(2000, 2000)) })
+    {
+        std::vector<const Collider*> expected;
+        for (std::size_t i = 0; i < colliders.size(); i++)
+        {
+            if (inserted[i] && query_box.intersects(colliders[i]->get_bounding_box()))
+                expected.push_back(colliders[i].get());
+        }
+        std::sort(expected.begin(), expected.end());
+        // Each Collider is reported once even when it spans several cells
+        grid.query(query_box, found);
+        std::sort(found.begin(), found.end());
+        REQUIRE(found == expected);
+    }
+
+    std::vector<std::pair<const Collider*, const Collider*>> expected_pairs;
+    for (std::size_t i = 0; i < colliders.size(); i++)
+    {
+        for (std::size_t j = 0; j < i; j++)
+        {
+            if (inserted[i] && inserted[j]
+                && colliders[i]->get_bounding_box().intersects(colliders[j]->get_bounding_box()))
+                expected_pairs.emplace_back(colliders[i].get(), colliders[j].get());
+        }
+    }
+    REQUIRE(normalized(grid.find_all_intersections()) == normalized(expected_pairs));
+
+    grid.clear();
+    grid.query(AABB(UnitVector(-1000, -1000), UnitVector(2000, 2000)), found);
+    CHECK(found.empty());
+}
+
+TEST_CASE("CollisionSpace broadphases should give the same results",
+    "[obe.Collision.SpatialHashGrid]")
+{
+    std::mt19937 generator(9);
+    auto colliders = make_clustered(2000, 200, generator);
+    CollisionSpace space;
+    for (const auto& collider : colliders)
+    {
+        space.add_collider(collider.get());
+    }
+    const auto quadtree_pairs = space.get_all_collisions();
+    std::vector<bool> quadtree_collides;
+    for (const auto& collider : colliders)
+    {
+        quadtree_collides.push_back(space.collides(*collider));
+    }
+
+    space.set_broadphase(BroadphaseType::SpatialHashGrid);
+    space.set_grid_cell_size(2);
+    CHECK(space.get_broadphase() == BroadphaseType::SpatialHashGrid);
+    CHECK(space.get_quadtree_stats().nodes == 0);
+    CHECK(space.get_all_collisions() == quadtree_pairs);
+    for (std::size_t i = 0; i < colliders.size(); i++)
+    {
+        REQUIRE(space.collides(*colliders[i]) == quadtree_collides[i]);
+    }
+
+    // Moved Colliders are reinserted in the grid like in the Quadtree
+    colliders.front()->set_position(colliders.back()->get_position());
+    CHECK(space.collides(*colliders.front()));
+    space.set_broadphase(BroadphaseType::Quadtree);
+    CHECK(space.collides(*colliders.front()));
+    CHECK_THROWS_AS(space.set_grid_cell_size(0), exceptions::InvalidGridCellSize);
+}
+
+TEST_CASE("CollisionSpace broadphase comparison", "[.][benchmark][obe.Collision.SpatialHashGrid]")
+{
+    constexpr std::size_t amount = 10000;
+    for (const bool clustered : { false, true })
+    {
+        std::mt19937 generator(42);
+        auto colliders = clustered ? make_clustered(amount, 400, generator)
+                                   : make_uniform(amount, 400, generator);
+        const char* workload = clustered ? "clustered" : "uniform";
+        std::uniform_real_distribution<double> steps(-0.5, 0.5);
+        std::vector<UnitVector> offsets;
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            offsets.emplace_back(steps(generator), steps(generator));
+        }
+
+        for (const BroadphaseType type : { BroadphaseType::Quadtree, BroadphaseType::SpatialHashGrid })
+        {
+            CollisionSpace space;
+            space.set_grid_cell_size(2);
+            space.set_broadphase(type);
+            for (const auto& collider : colliders)
+            {
+                space.add_collider(collider.get());
+            }
+            const std::string name = BroadphaseTypeMeta::to_string(type);
+
+            BENCHMARK(fmt::format("{}: update 10% moving ({} {} Colliders)", name, amount, workload))
+            {
+                for (std::size_t i = 0; i < amount; i += 10)
+                {
+                    colliders[i]->move(offsets[i]);
+                    offsets[i] = offsets[i] * -1.0;
+                }
+                space.update();
+            };
+            BENCHMARK(fmt::format("{}: collides on 1000 Colliders ({} {} Colliders)", name,
+                amount, workload))
+            {
+                std::size_t colliding = 0;
+                for (std::size_t i = 0; i < amount; i += 10)
+                    colliding += space.collides(*colliders[i]);
+                return colliding;
+            };
+            BENCHMARK(fmt::format("{}: all pairs ({} {} Colliders)", name, amount, workload))
+            {
+                return space.get_all_collisions().size();
+            };
+        }
+    }
+}
@@ -0,0 +1,149 @@
+#include <catch_amalgamated.hpp>
+
+#include <memory>
+
+#include <fmt/format.h>
+
+#include <Collision/CollisionSpace.hpp>
+#include <Collision/RectangleCollider.hpp>
+#include <Collision/TrajectoryNode.hpp>
+
+using namespace obe::collision;
+using obe::scene::SceneNode;
+using obe::transform::UnitVector;
+
+namespace
+{
+    /**
+     * \brief RectangleCollider counting the Colliders it is tested against, one test
+     *        per Collider returned by the broadphase
+     */
+    class CountingProbe : public RectangleCollider
+    {
+    public:
+        using RectangleCollider::get_offset_before_collision;
+        mutable std::size_t tests = 0;
+
+        CountingProbe()
+            : RectangleCollider(UnitVector(0, 0), UnitVector(1, 1))
+        {
+        }
+
+        UnitVector get_offset_before_collision(const Collider& collider,
+            const UnitVector& self_offset, const UnitVector& other_offset) const override
+        {
+            tests++;
+            return RectangleCollider::get_offset_before_collision(
+                collider, self_offset, other_offset);
+        }
+    };
+
+    struct RunResult
+    {
+        double x;
+        std::size_t tests;
+        std::size_t collisions;
+    };
+
+    /**
+     * \brief Moves a probe diagonally through a field of obstacles for one second,
+     *        towards a thin wall at x = 70
+     */
+    class DiagonalRun
+    {
+    private:
+        std::vector<std::unique_ptr<RectangleCollider>> m_obstacles;
+        CollisionSpace m_space;
+        CountingProbe m_probe;
+        SceneNode m_scene_node;
+        TrajectoryNode m_node;
+        std::size_t m_collisions = 0;
+
+    public:
+        DiagonalRun(double speed, double substep_length)
+            : m_node(m_scene_node)
+        {
+            // Obstacles stay clear of the diagonal band swept by the probe
+            for (int x = 0; x < 68; x += 3)
+            {
+                for (int y = -100; y < 20; y += 3)
+                {
+                    if (x + y >= 4 || x + y <= -4)
+                    {
+                        m_obstacles.push_back(std::make_unique<RectangleCollider>(
+                            UnitVector(x, y), UnitVector(1, 1)));
+                    }
+                }
+            }
+            m_obstacles.push_back(
+                std::make_unique<RectangleCollider>(UnitVector(70, -100), UnitVector(0.1, 120)));
+            for (const auto& obstacle : m_obstacles)
+            {
+                m_space.add_collider(obstacle.get());
+            }
+            m_space.add_collider(&m_probe);
+            m_scene_node.add_child(m_probe);
+            m_node.set_probe(&m_space, &m_probe);
+            Trajectory& trajectory = m_node.add_trajectory("dash")
+                                         .set_speed(speed)
+                                         .set_angle(45)
+                                         .set_substep_length(substep_length);
+            trajectory.on_collide(
+                [this](Trajectory&, UnitVector, const Collider*) { m_collisions++; });
+        }
+
+        RunResult run(int rate)
+        {
+            for (int frame = 0; frame < rate; frame++)
+            {
+                m_node.update(1.0 / rate);
+                m_space.update();
+            }
+            return RunResult { m_probe.get_position().x, m_probe.tests, m_collisions };
+        }
+    };
+}
+
+TEST_CASE("Trajectory substeps should not let fast probes tunnel",
+    "[obe.Collision.TrajectoryNode]")
+{
+    // Offsets are compared in ScenePixels, one pixel per SceneUnit keeps them as is
+    UnitVector::Screen.w = 1;
+    UnitVector::Screen.h = 1;
+    for (const int rate : { 30, 60, 144 })
+    {
+        INFO(fmt::format("{} Hz", rate));
+        const RunResult whole = DiagonalRun(200, 0).run(rate);
+        const RunResult substeps = DiagonalRun(200, 1).run(rate);
+        // The probe ends against the wall either way
+        CHECK(whole.x == Catch::Approx(69).margin(0.05));
+        CHECK(substeps.x == Catch::Approx(69).margin(0.05));
+        CHECK(whole.collisions > 0);
+        CHECK(substeps.collisions > 0);
+        if (rate == 30)
+        {
+            // Large frame offsets sweep over obstacles that smaller substeps never reach
+            CHECK(substeps.tests < whole.tests);
+        }
+    }
+}
+
+TEST_CASE("Trajectory substeps throughput", "[.][benchmark][obe.Collision.TrajectoryNode]")
+{
+    UnitVector::Screen.w = 1;
+    UnitVector::Screen.h = 1;
+    for (const int rate : { 30, 60, 144 })
+    {
+        for (const double substep_length : { 0.0, 1.0, 4.0 })
+        {
+            BENCHMARK_ADVANCED(fmt::format("{} Hz, substep length {}", rate, substep_length))
+            (Catch::Benchmark::Chronometer meter)
+            {
+                std::vector<std::unique_ptr<DiagonalRun>> runs;
+                for (int i = 0; i < meter.runs(); i++)
+                    runs.push_back(std::make_unique<DiagonalRun>(200, substep_length));
+                meter.measure([&runs, rate](int i) { return runs[i]->run(rate).tests; });
+            };
+        }
+    }
+}
@@ -0,0 +1,111 @@
+#include <catch_amalgamated.hpp>
+
+#include <memory>
+
+#include <Collision/CollisionSpace.hpp>
+#include <Collision/Exceptions.hpp>
+#include <Collision/RectangleCollider.hpp>
+#include <Collision/TrajectorySystem.hpp>
+
+using namespace obe::collision;
+using obe::scene::SceneNode;
+using obe::transform::UnitVector;
+
+TEST_CASE("TrajectorySystem should move nodes like TrajectoryNode::update",
+    "[obe.Collision.TrajectorySystem]")
+{
+    TrajectorySystem system;
+    SceneNode managed_node;
+    SceneNode manual_node;
+    TrajectoryNode managed(managed_node, system);
+    TrajectoryNode manual(manual_node);
+    CHECK(system.contains(managed));
+    CHECK_FALSE(system.contains(manual));
+    CHECK(managed.get_system() == &system);
+    CHECK(manual.get_system() == nullptr);
+    for (TrajectoryNode* node : { &managed, &manual })
+    {
+        node->add_trajectory("walk").set_speed(10);
+        node->add_trajectory("fall").set_angle(270).set_acceleration(2);
+        node->add_trajectory("frozen").set_speed(100).set_static(true);
+    }
+    CHECK_THROWS_AS(managed.add_trajectory("walk"), exceptions::TrajectoryAlreadyExists);
+    CHECK_THROWS_AS(managed.get_trajectory("jump"), exceptions::UnknownTrajectory);
+
+    for (int i = 0; i < 5; i++)
+    {
+        system.update(0.5);
+        manual.update(0.5);
+    }
+    CHECK(managed_node.get_position().x == Catch::Approx(25));
+    CHECK(managed_node.get_position().y == Catch::Approx(manual_node.get_position().y));
+    CHECK(managed_node.get_position().x == Catch::Approx(manual_node.get_position().x));
+    CHECK(managed.get_trajectory("fall").get_speed() == Catch::Approx(5));
+
+    system.set_enabled(false);
+    system.update(1);
+    CHECK(managed_node.get_position().x == Catch::Approx(25));
+}
+
+TEST_CASE("TrajectorySystem should stop probes on collision", "[obe.Collision.TrajectorySystem]")
+{
+    // Offsets are compared in ScenePixels, one pixel per SceneUnit keeps them as is
+    UnitVector::Screen.w = 1;
+    UnitVector::Screen.h = 1;
+    CollisionSpace space;
+    RectangleCollider wall(UnitVector(5, -5), UnitVector(1, 10));
+    RectangleCollider probe(UnitVector(0, 0), UnitVector(1, 1));
+    space.add_collider(&wall);
+    space.add_collider(&probe);
+
+    SceneNode scene_node;
+    scene_node.add_child(probe);
+    TrajectorySystem system;
+    TrajectoryNode node(scene_node, system);
+    node.set_probe(&space, &probe);
+    Trajectory& trajectory = node.add_trajectory("dash").set_speed(10);
+    int collisions = 0;
+    trajectory.on_collide(
+        [&collisions](Trajectory&, UnitVector, const Collider*) { collisions++; });
+
+    system.update(1);
+    CHECK(probe.get_position().x == Catch::Approx(4).margin(0.01));
+    CHECK(collisions == 1);
+
+    // Rejected Colliders do not stop the probe anymore
+    trajectory.set_reachable_collider_acceptor(
+        [&wall](Trajectory&, const Collider* collider) { return collider != &wall; });
+    system.update(1);
+    CHECK(probe.get_position().x == Catch::Approx(14).margin(0.01));
+    CHECK(collisions == 1);
+}
+
+TEST_CASE("TrajectorySystem should support removing nodes while updating",
+    "[obe.Collision.TrajectorySystem]")
+{
+    TrajectorySystem system;
+    SceneNode first_scene_node;
+    SceneNode second_scene_node;
+    auto first = std::make_unique<TrajectoryNode>(first_scene_node, system);
+    auto second = std::make_unique<TrajectoryNode>(second_scene_node, system);
+    auto third = std::make_unique<TrajectoryNode>(second_scene_node, system);
+    CHECK(system.get_nodes_amount() == 3);
+
+    // The first node destroys the second one from one of its checks
+    first->add_trajectory("move").set_speed(1).add_check(
+        [&second](Trajectory&, UnitVector&, const Collider*) { second.reset(); });
+    system.update(1);
+    CHECK(system.get_nodes_amount() == 2);
+    CHECK(first_scene_node.get_position().x == Catch::Approx(1));
+
+    system.remove_nodes(second_scene_node);
+    CHECK(system.get_nodes_amount() == 1);
+    CHECK(third->get_system() == nullptr);
+
+    TrajectorySystem other;
+    other.add(*first);
+    CHECK(system.get_nodes_amount() == 0);
+    CHECK(other.contains(*first));
+    first.reset();
+    CHECK(other.get_nodes_amount() == 0);
+}
@@ -0,0 +1,109 @@
+#include <catch_amalgamated.hpp>
+
+#include <fmt/format.h>
+#include <spdlog/sinks/null_sink.h>
+
+#include <Debug/Logger.hpp>
+#include <Event/EventManager.hpp>
+
+using namespace obe::event;
+
+namespace
+{
+    void setup_logger()
+    {
+        if (!obe::debug::Log)
+        {
+            obe::debug::Log = std::make_shared<spdlog::logger>(
+                "tests", std::make_shared<spdlog::sinks::null_sink_st>());
+        }
+    }
+}
+
+TEST_CASE("CallbackSchedulers should only fire once their deadline is reached",
+    "[obe.Event.CallbackScheduler]")
+{
+    setup_logger();
+    EventManager manager;
+    int immediate = 0;
+    int later = 0;
+    int stopped = 0;
+    manager.schedule().after(0).run([&immediate]() { immediate++; });
+    manager.schedule().after(3600).run([&later]() { later++; });
+    CallbackScheduler& stopped_scheduler = manager.schedule().after(0);
+    stopped_scheduler.run([&stopped]() { stopped++; });
+    stopped_scheduler.stop();
+
+    manager.update();
+    manager.update();
+    CHECK(immediate == 1);
+    CHECK(later == 0);
+    CHECK(stopped == 0);
+}
+
+TEST_CASE("Repeating CallbackSchedulers should fire at most once per update",
+    "[obe.Event.CallbackScheduler]")
+{
+    setup_logger();
+    EventManager manager;
+    int calls = 0;
+    int nested_calls = 0;
+    CallbackScheduler& scheduler = manager.schedule().every(0);
+    scheduler.run([&]() {
+        calls++;
+        // Schedulers created from a callback wait for the next update
+        if (calls == 1)
+            manager.schedule().after(0).run([&nested_calls]() { nested_calls++; });
+    });
+
+    manager.update();
+    CHECK(calls == 1);
+    CHECK(nested_calls == 0);
+    manager.update();
+    CHECK(calls == 2);
+    CHECK(nested_calls == 1);
+    scheduler.stop();
+    manager.update();
+    CHECK(calls == 2);
+}
+
+TEST_CASE("CallbackSchedulers should follow the virtual frame clock",
+    "[obe.Event.CallbackScheduler]")
+{
+    setup_logger();
+    obe::time::set_virtual_clock(0.25);
+    EventManager manager;
+    int calls = 0;
+    manager.schedule().after(1).run([&calls]() { calls++; });
+    manager.update();
+    for (int frame = 1; frame <= 3; frame++)
+    {
+        obe::time::advance_frame();
+        manager.update();
+    }
+    CHECK(calls == 0);
+    obe::time::advance_frame();
+    manager.update();
+    CHECK(calls == 1);
+    obe::time::set_virtual_clock(0);
+}
+
+TEST_CASE("EventManager update cost with idle CallbackSchedulers",
+    "[.][benchmark][obe.Event.CallbackScheduler]")
+{
+    setup_logger();
+    for (const int schedulers_amount : { 10, 1000, 10000 })
+    {
+        EventManager manager;
+        int calls = 0;
+        for (int i = 0; i < schedulers_amount; i++)
+        {
+            manager.schedule().after(3600).run([&calls]() { calls++; });
+        }
+        BENCHMARK(fmt::format("{} schedulers", schedulers_amount))
+        {
+            manager.update();
+            return calls;
+        };
+    }
+}
@@ -0,0 +1,276 @@
+#include <catch_amalgamated.hpp>
+
+#include <fmt/format.h>
+#include <spdlog/sinks/null_sink.h>
+
+#include <Debug/Logger.hpp>
+#include <Event/EventGroup.hpp>
+#include <Event/EventManager.hpp>
+
+using namespace obe::event;
+
+namespace
+{
+    struct Tick
+    {
+        static constexpr std::string_view id = "Tick";
+        int value = 0;
+    };
+
+    // Most engine events hold const members and cannot be assigned to
+    struct Message
+    {
+        static constexpr std::string_view id = "Message";
+        const std::string content;
+    };
+
+    void setup_logger()
+    {
+        if (!obe::debug::Log)
+        {
+            obe::debug::Log = std::make_shared<spdlog::logger>(
+                "tests", std::make_shared<spdlog::sinks::null_sink_st>());
+        }
+    }
+}
+
+TEST_CASE("Event listeners should be reachable by id and by handle", "[obe.Event.Event]")
+{
+    setup_logger();
+    EventGroup group("Tests", "Group");
+    group.add<Tick>();
+    Event<Tick>& tick = group.get<Tick>("Tick");
+
+    int added = 0;
+    int removed = 0;
+    group.on_add_listener("Tick", [&added](ListenerChangeState, const std::string&) { added++; });
+    group.on_remove_listener(
+        "Tick", [&removed](ListenerChangeState, const std::string&) { removed++; });
+
+    int total = 0;
+    const ListenerHandle named
+        = tick.add_listener("named", [&total](const Tick& event) { total += event.value; });
+    const ListenerHandle anonymous
+        = tick.add_listener([&total](const Tick& event) { total += 10 * event.value; });
+    // Adding an already used id keeps the first listener
+    CHECK(tick.add_listener("named", [](const Tick&) {}) == named);
+    CHECK(tick.get_listeners_amount() == 2);
+    CHECK(added == 2);
+
+    group.trigger(Tick { 1 });
+    CHECK(total == 11);
+
+    tick.remove_listener("named");
+    tick.remove_listener(anonymous);
+    // Removing twice is a no-op
+    tick.remove_listener(anonymous);
+    tick.remove_listener("named");
+    CHECK(removed == 2);
+    CHECK(tick.get_listeners_amount() == 0);
+
+    // The slot is reused, the stale handle must not remove the new listener
+    const ListenerHandle reused = tick.add_listener([&total](const Tick&) { total += 100; });
+    CHECK(reused.index == anonymous.index);
+    CHECK_FALSE(reused == anonymous);
+    tick.remove_listener(anonymous);
+    group.trigger(Tick { 1 });
+    CHECK(total == 111);
+}
+
+TEST_CASE("Event listeners should support being added and removed while triggering",
+    "[obe.Event.Event]")
+{
+    setup_logger();
+    EventGroup group("Tests", "Group");
+    group.add<Tick>();
+    Event<Tick>& tick = group.get<Tick>("Tick");
+
+    std::vector<std::string> calls;
+    ListenerHandle third;
+    tick.add_listener("first", [&](const Tick&) {
+        calls.emplace_back("first");
+        // Removes itself and a listener that has not been called yet
+        tick.remove_listener("first");
+        tick.remove_listener(third);
+        tick.add_listener("late", [&calls](const Tick&) { calls.emplace_back("late"); });
+    });
+    tick.add_listener("second", [&calls](const Tick&) { calls.emplace_back("second"); });
+    third = tick.add_listener("third", [&calls](const Tick&) { calls.emplace_back("third"); });
+
+    group.trigger(Tick {});
+    CHECK(calls == std::vector<std::string> { "first", "second" });
+    CHECK(tick.get_listeners_amount() == 2);
+
+    calls.clear();
+    group.trigger(Tick {});
+    CHECK(calls == std::vector<std::string> { "second", "late" });
+}
+
+TEST_CASE("Queued EventGroups should deliver their events on flush", "[obe.Event.EventGroup]")
+{
+    setup_logger();
+    EventManager manager;
+    EventNamespace& event_namespace = manager.create_namespace("Tests");
+    const EventGroupPtr group = event_namespace.create_group("Network");
+    group->add<Message>();
+    group->add<Tick>();
+    group->set_queued(true);
+
+    std::vector<std::string> received;
+    int ticks = 0;
+    group->get<Message>("Message").add_listener("receiver", [&](const Message& event) {
+        received.push_back(event.content);
+        // Events queued while flushing wait for the next flush
+        if (event.content == "first")
+            group->trigger(Message { "late" });
+    });
+    group->get<Tick>("Tick").add_listener("counter", [&ticks](const Tick&) { ticks++; });
+
+    group->trigger(Message { "first" });
+    group->trigger(Message { "second" });
+    group->trigger(Tick {});
+    CHECK(received.empty());
+    CHECK(group->get("Message").get_queued_amount() == 2);
+
+    manager.flush();
+    CHECK(received == std::vector<std::string> { "first", "second" });
+    CHECK(ticks == 1);
+    CHECK(group->get("Message").get_queued_amount() == 1);
+
+    // Coalescing Events only deliver the last event queued since the last flush
+    received.clear();
+    group->get("Message").set_coalescing(true);
+    group->trigger(Message { "third" });
+    group->trigger(Message { "fourth" });
+    manager.flush();
+    CHECK(received == std::vector<std::string> { "fourth" });
+
+    // Leaving the queued mode delivers pending events right away
+    group->trigger(Tick {});
+    group->set_queued(false);
+    CHECK(ticks == 2);
+    group->trigger(Tick {});
+    CHECK(ticks == 3);
+}
+
+TEST_CASE("Batched Events should call Lua listeners once per flush", "[obe.Event.EventGroup]")
+{
+    setup_logger();
+    sol::state lua;
+    lua.open_libraries(sol::lib::base);
+    lua.new_usertype<Tick>("Tick", "value", &Tick::value);
+    lua.script(R"(
+        calls = 0
+        total = 0
+        function on_ticks(ticks)
+            calls = calls + 1
+            for _, tick in ipairs(ticks) do
+                total = total + tick.value
+            end
+        end
+    )");
+
+    EventGroup group("Tests", "Group");
+    group.add<Tick>();
+    group.set_queued(true);
+    group.get("Tick").set_batched(true);
+    group.get("Tick").add_external_listener(
+        "lua", LuaEventListener(lua["on_ticks"].get<sol::protected_function>()));
+    int cpp_calls = 0;
+    group.get<Tick>("Tick").add_listener("cpp", [&cpp_calls](const Tick&) { cpp_calls++; });
+
+    for (int i = 1; i <= 4; i++)
+        group.trigger(Tick { i });
+    group.flush();
+    CHECK(lua["calls"].get<int>() == 1);
+    CHECK(lua["total"].get<int>() == 10);
+    // C++ listeners keep receiving events one by one
+    CHECK(cpp_calls == 4);
+}
+
+TEST_CASE("Lua listeners should share the payload of a trigger", "[obe.Event.Event]")
+{
+    setup_logger();
+    sol::state lua;
+    lua.open_libraries(sol::lib::base, sol::lib::debug);
+    lua.new_usertype<Tick>("Tick", "value", &Tick::value);
+    lua.script(R"(
+        received = {}
+        function on_tick(tick)
+            received[#received + 1] = tick
+        end
+        function on_tick_error(tick)
+            error("tick " .. tick.value)
+        end
+    )");
+
+    EventGroup group("Tests", "Group");
+    group.add<Tick>();
+    EventBase& tick = group.get("Tick");
+    tick.add_external_listener(
+        "first", LuaEventListener(lua["on_tick"].get<sol::protected_function>()));
+    tick.add_external_listener(
+        "second", LuaEventListener(lua["on_tick"].get<sol::protected_function>()));
+    group.trigger(Tick { 3 });
+    group.trigger(Tick { 4 });
+    CHECK(lua.script("return received[1] == received[2]").get<bool>());
+    CHECK_FALSE(lua.script("return received[2] == received[3]").get<bool>());
+    CHECK(lua.script("return received[1].value + received[3].value").get<int>() == 7);
+
+    tick.add_external_listener(
+        "faulty", LuaEventListener(lua["on_tick_error"].get<sol::protected_function>()));
+    CHECK_THROWS_AS(group.trigger(Tick { 5 }), exceptions::EventExecutionError);
+    // The Lua stack is left as it was before the failing call
+    CHECK(lua_gettop(lua.lua_state()) == 0);
+}
+
+TEST_CASE("Event dispatch cost per listener", "[.][benchmark][obe.Event.Event]")
+{
+    setup_logger();
+    for (const int listeners_amount : { 1, 100, 1000 })
+    {
+        EventGroup group("Tests", "Group");
+        group.add<Tick>();
+        Event<Tick>& tick = group.get<Tick>("Tick");
+        int total = 0;
+        for (int i = 0; i < listeners_amount; i++)
+        {
+            tick.add_listener(fmt::format("listener_{}", i),
+                [&total](const Tick& event) { total += event.value; });
+        }
+        BENCHMARK(fmt::format("{} listeners", listeners_amount))
+        {
+            group.trigger(Tick { 1 });
+            return total;
+        };
+    }
+}
+
+TEST_CASE("Lua event dispatch cost per listener", "[.][benchmark][obe.Event.Event]")
+{
+    setup_logger();
+    sol::state lua;
+    lua.open_libraries(sol::lib::base);
+    lua.new_usertype<Tick>("Tick", "value", &Tick::value);
+    lua.script(R"(
+        total = 0
+        function on_tick(tick)
+            total = total + tick.value
+        end
+    )");
+    for (const int listeners_amount : { 1, 100, 1000 })
+    {
+        EventGroup group("Tests", "Group");
+        group.add<Tick>();
+        for (int i = 0; i < listeners_amount; i++)
+        {
+            group.get("Tick").add_external_listener(fmt::format("listener_{}", i),
+                LuaEventListener(lua["on_tick"].get<sol::protected_function>()));
+        }
+        BENCHMARK(fmt::format("{} Lua listeners", listeners_amount))
+        {
+            group.trigger(Tick { 1 });
+            return lua["total"].get<int>();
+        };
+    }
+}
@@ -0,0 +1,164 @@
+#include <catch_amalgamated.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+
+#include <fmt/format.h>
+
+#include <Graphics/RenderQueue.hpp>
+#include <Graphics/Renderable.hpp>
+
+using namespace obe::graphics;
+
+namespace
+{
+    class DummyRenderable : public Renderable
+    {
+    public:
+        using Renderable::Renderable;
+        void draw(RenderTarget&, const obe::scene::Camera&) override
+        {
+        }
+    };
+
+    bool is_in_draw_order(const std::vector<Renderable*>& renderables)
+    {
+        return std::is_sorted(renderables.begin(), renderables.end(),
+            [](const Renderable* renderable1, const Renderable* renderable2) {
+                if (renderable1->get_layer() == renderable2->get_layer())
+                {
+                    return renderable1->get_sublayer() > renderable2->get_sublayer();
+                }
+                return renderable1->get_layer() > renderable2->get_layer();
+            });
+    }
+
+    std::vector<std::unique_ptr<DummyRenderable>> make_renderables(std::size_t amount)
+    {
+        std::mt19937 generator(42);
+        std::uniform_int_distribution<int32_t> layers(-5, 5);
+        std::vector<std::unique_ptr<DummyRenderable>> renderables;
+        renderables.reserve(amount);
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            renderables.push_back(
+                std::make_unique<DummyRenderable>(layers(generator), layers(generator)));
+        }
+        return renderables;
+    }
+}
+
+TEST_CASE("RenderQueue should keep Renderables in draw order", "[obe.Graphics.RenderQueue]")
+{
+    RenderQueue queue;
+    DummyRenderable front(1, 1);
+    DummyRenderable middle(2, 0);
+    DummyRenderable back(2, 3);
+    queue.add(front);
+    queue.add(back);
+    queue.add(middle);
+
+    SECTION("Insertion")
+    {
+        REQUIRE(queue.size() == 3);
+        REQUIRE(queue.get_renderables()
+            == std::vector<Renderable*> { &back, &middle, &front });
+    }
+    SECTION("Layer change")
+    {
+        front.set_layer(10);
+        REQUIRE(queue.get_renderables()
+            == std::vector<Renderable*> { &front, &back, &middle });
+        middle.set_sublayer(5);
+        REQUIRE(queue.get_renderables()
+            == std::vector<Renderable*> { &front, &middle, &back });
+    }
+    SECTION("Same layer keeps insertion order")
+    {
+        DummyRenderable twin(1, 1);
+        queue.add(twin);
+        REQUIRE(queue.get_renderables()
+            == std::vector<Renderable*> { &back, &middle, &front, &twin });
+    }
+    SECTION("Removal")
+    {
+        queue.remove(middle);
+        REQUIRE_FALSE(queue.contains(middle));
+        REQUIRE(queue.get_renderables() == std::vector<Renderable*> { &back, &front });
+        {
+            DummyRenderable temporary(0, 0);
+            queue.add(temporary);
+            REQUIRE(queue.size() == 3);
+        }
+        REQUIRE(queue.get_renderables() == std::vector<Renderable*> { &back, &front });
+    }
+}
+
+TEST_CASE("RenderQueue should stay sorted after random layer changes",
+    "[obe.Graphics.RenderQueue]")
+{
+    RenderQueue queue;
+    auto renderables = make_renderables(500);
+    for (auto& renderable : renderables)
+    {
+        queue.add(*renderable);
+    }
+    REQUIRE(is_in_draw_order(queue.get_renderables()));
+
+    std::mt19937 generator(7);
+    std::uniform_int_distribution<std::size_t> picker(0, renderables.size() - 1);
+    std::uniform_int_distribution<int32_t> layers(-5, 5);
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        DummyRenderable& renderable = *renderables[picker(generator)];
+        if (i % 2)
+            renderable.set_layer(layers(generator));
+        else
+            renderable.set_sublayer(layers(generator));
+    }
+    REQUIRE(queue.size() == renderables.size());
+    REQUIRE(is_in_draw_order(queue.get_renderables()));
+}
+
+TEST_CASE("RenderQueue per-frame cost", "[.][benchmark][obe.Graphics.RenderQueue]")
+{
+    for (const std::size_t amount : { 1000, 10000 })
+    {
+        auto renderables = make_renderables(amount);
+        RenderQueue queue;
+        std::vector<Renderable*> cache;
+        for (auto& renderable : renderables)
+        {
+            queue.add(*renderable);
+        }
+
+        BENCHMARK(fmt::format("Copy and sort every frame ({} Renderables)", amount))
+        {
+            cache.clear();
+            for (auto& renderable : renderables)
+            {
+                cache.push_back(renderable.get());
+            }
+            std::sort(cache.begin(), cache.end(), [](const auto& lhs, const auto& rhs) {
+                if (lhs->get_layer() == rhs->get_layer())
+                    return lhs->get_sublayer() > rhs->get_sublayer();
+                return lhs->get_layer() > rhs->get_layer();
+            });
+            return cache.size();
+        };
+        BENCHMARK(fmt::format("Persistent RenderQueue ({} Renderables)", amount))
+        {
+            return queue.get_renderables().size();
+        };
+        BENCHMARK(
+            fmt::format("Persistent RenderQueue with 1% layer changes ({} Renderables)", amount))
+        {
+            for (std::size_t i = 0; i < amount; i += 100)
+            {
+                renderables[i]->set_sublayer(renderables[i]->get_sublayer() == 0 ? 1 : 0);
+            }
+            return queue.get_renderables().size();
+        };
+    }
+}
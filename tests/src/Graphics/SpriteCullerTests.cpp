@@ -0,0 +1,171 @@
+#include <catch_amalgamated.hpp>
+
+#include <memory>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteCuller.hpp>
+#include <Scene/Camera.hpp>
+
+using namespace obe::graphics;
+using obe::scene::Camera;
+using obe::transform::Referential;
+using obe::transform::UnitVector;
+
+namespace
+{
+    /**
+     * \brief Square screen, a Camera of size 1 covers 2x2 SceneUnits from its position
+     */
+    void setup_camera(Camera& camera, double x, double y)
+    {
+        UnitVector::Screen.w = 100;
+        UnitVector::Screen.h = 100;
+        camera.set_size(1);
+        camera.set_position(UnitVector(x, y), Referential::TopLeft);
+    }
+
+    std::unique_ptr<Sprite> make_sprite(const std::string& id, double x, double y)
+    {
+        auto sprite = std::make_unique<Sprite>(id);
+        sprite->set_size(UnitVector(0.5, 0.5));
+        sprite->set_position(UnitVector(x, y), Referential::TopLeft);
+        return sprite;
+    }
+}
+
+TEST_CASE("SpriteCuller should cull Sprites outside of the Camera", "[obe.Graphics.SpriteCuller]")
+{
+    Camera camera;
+    setup_camera(camera, 0, 0);
+    SpriteCuller culler;
+    const auto inside = make_sprite("inside", 0.5, 0.5);
+    const auto overlapping = make_sprite("overlapping", 1.75, -0.25);
+    const auto outside = make_sprite("outside", 10, 10);
+    for (Sprite* sprite : { inside.get(), overlapping.get(), outside.get() })
+    {
+        culler.add(*sprite);
+    }
+
+    culler.update(camera);
+    CHECK_FALSE(inside->is_culled());
+    CHECK_FALSE(overlapping->is_culled());
+    CHECK(outside->is_culled());
+
+    // Removed Sprites are never culled
+    culler.remove(*outside);
+    culler.update(camera);
+    CHECK_FALSE(outside->is_culled());
+    CHECK(culler.get_stats().sprites == 2);
+
+    culler.add(*outside);
+    culler.update(camera);
+    CHECK(outside->is_culled());
+    culler.uncull_all();
+    CHECK_FALSE(outside->is_culled());
+    CHECK(culler.get_stats().culled == 0);
+}
+
+TEST_CASE("SpriteCuller should use the visible range of Parallax layers",
+    "[obe.Graphics.SpriteCuller]")
+{
+    Camera camera;
+    setup_camera(camera, 10, 10);
+    SpriteCuller culler;
+    // The Camera sees [10, 12] while a Parallax layer 2 sees [5, 7]
+    const auto near_camera = make_sprite("near_camera", 10.5, 10.5);
+    const auto parallax_near_camera = make_sprite("parallax_near_camera", 10.5, 10.5);
+    const auto parallax_visible = make_sprite("parallax_visible", 5.5, 5.5);
+    for (Sprite* sprite : { parallax_near_camera.get(), parallax_visible.get() })
+    {
+        sprite->set_layer(2);
+        sprite->set_position_transformer(PositionTransformer("Parallax", "Parallax"));
+    }
+    // Parallax on layer 0 has no visible range, these Sprites are never culled
+    const auto parallax_layer_zero = make_sprite("parallax_layer_zero", 100, 100);
+    parallax_layer_zero->set_layer(0);
+    parallax_layer_zero->set_position_transformer(PositionTransformer("Parallax", "Parallax"));
+    for (Sprite* sprite : { near_camera.get(), parallax_near_camera.get(),
+             parallax_visible.get(), parallax_layer_zero.get() })
+    {
+        culler.add(*sprite);
+    }
+
+    culler.update(camera);
+    CHECK_FALSE(near_camera->is_culled());
+    CHECK(parallax_near_camera->is_culled());
+    CHECK_FALSE(parallax_visible->is_culled());
+    CHECK_FALSE(parallax_layer_zero->is_culled());
+
+    // Changing layer moves the Sprite to the range of its new layer
+    parallax_visible->set_layer(1);
+    culler.update(camera);
+    CHECK(parallax_visible->is_culled());
+    CHECK(culler.get_stats().reindexed == 1);
+}
+
+TEST_CASE("SpriteCuller should follow Sprites moving across cells", "[obe.Graphics.SpriteCuller]")
+{
+    Camera camera;
+    setup_camera(camera, 0, 0);
+    SpriteCuller culler;
+    culler.set_cell_size(0.5);
+    const auto sprite = make_sprite("moving", 0.5, 0.5);
+    culler.add(*sprite);
+    // Covers more cells than the Camera so only the cells in view are queried
+    const auto filler = make_sprite("filler", 100, 100);
+    filler->set_size(UnitVector(5, 5));
+    culler.add(*filler);
+
+    culler.update(camera);
+    CHECK_FALSE(sprite->is_culled());
+    CHECK(culler.get_stats().reindexed == 0);
+
+    sprite->move(UnitVector(20, 0));
+    culler.update(camera);
+    CHECK(sprite->is_culled());
+    CHECK(culler.get_stats().reindexed == 1);
+
+    // The Sprite is not left behind in the cells it used to cover
+    camera.set_position(UnitVector(20, 0), Referential::TopLeft);
+    culler.update(camera);
+    CHECK_FALSE(sprite->is_culled());
+    CHECK(culler.get_stats().reindexed == 0);
+    camera.set_position(UnitVector(0, 0), Referential::TopLeft);
+    culler.update(camera);
+    CHECK(sprite->is_culled());
+    CHECK(culler.get_stats().tested == 0);
+}
+
+TEST_CASE("SpriteCuller should count the culled and tested Sprites", "[obe.Graphics.SpriteCuller]")
+{
+    Camera camera;
+    setup_camera(camera, 0, 0);
+    SpriteCuller culler;
+    // One Sprite per cell, the Camera overlaps the 3x3 cells starting at the origin
+    std::vector<std::unique_ptr<Sprite>> sprites;
+    for (int x = 0; x < 20; x++)
+    {
+        for (int y = 0; y < 20; y++)
+        {
+            sprites.push_back(make_sprite(fmt::format("sprite_{}_{}", x, y), x, y));
+            culler.add(*sprites.back());
+        }
+    }
+
+    culler.update(camera);
+    const CullingStats stats = culler.get_stats();
+    CHECK(stats.sprites == 400);
+    CHECK(stats.tested == 9);
+    CHECK(stats.culled == 391);
+    CHECK(stats.reindexed == 0);
+    std::size_t visible = 0;
+    for (const auto& sprite : sprites)
+    {
+        if (!sprite->is_culled())
+            visible++;
+    }
+    CHECK(visible == 9);
+}
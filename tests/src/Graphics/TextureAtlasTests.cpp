@@ -0,0 +1,88 @@
+#include <catch_amalgamated.hpp>
+
+#include <random>
+#include <vector>
+
+#include <Graphics/TextureAtlas.hpp>
+
+using namespace obe::graphics;
+
+namespace
+{
+    struct PlacedRect
+    {
+        uint32_t x;
+        uint32_t y;
+        uint32_t width;
+        uint32_t height;
+    };
+
+    bool overlaps(const PlacedRect& rect1, const PlacedRect& rect2)
+    {
+        return rect1.x < rect2.x + rect2.width && rect2.x < rect1.x + rect1.width
+            && rect1.y < rect2.y + rect2.height && rect2.y < rect1.y + rect1.height;
+    }
+}
+
+TEST_CASE("ShelfPacker places rectangles without overlap", "[obe.graphics.ShelfPacker]")
+{
+    ShelfPacker packer(512, 512);
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<uint32_t> sizes(1, 64);
+    std::vector<PlacedRect> placed;
+    uint64_t expected_area = 0;
+    for (std::size_t i = 0; i < 200; i++)
+    {
+        const uint32_t width = sizes(generator);
+        const uint32_t height = sizes(generator);
+        const std::optional<sf::Vector2u> position = packer.insert(width, height);
+        if (!position)
+        {
+            continue;
+        }
+        const PlacedRect rect { position->x, position->y, width, height };
+        REQUIRE(rect.x + rect.width <= 512);
+        REQUIRE(rect.y + rect.height <= 512);
+        for (const PlacedRect& other : placed)
+        {
+            REQUIRE_FALSE(overlaps(rect, other));
+        }
+        placed.push_back(rect);
+        expected_area += static_cast<uint64_t>(width) * height;
+    }
+    CHECK(placed.size() > 50);
+    CHECK(packer.get_used_area() == expected_area);
+}
+
+TEST_CASE("ShelfPacker reuses shelves of matching height", "[obe.graphics.ShelfPacker]")
+{
+    ShelfPacker packer(64, 64);
+    SECTION("Rectangles of the same height share a shelf")
+    {
+        REQUIRE(packer.insert(16, 16) == sf::Vector2u(0, 0));
+        REQUIRE(packer.insert(16, 16) == sf::Vector2u(16, 0));
+        REQUIRE(packer.insert(16, 8) == sf::Vector2u(32, 0));
+    }
+    SECTION("Taller rectangles open a new shelf")
+    {
+        REQUIRE(packer.insert(16, 16) == sf::Vector2u(0, 0));
+        REQUIRE(packer.insert(16, 32) == sf::Vector2u(0, 16));
+    }
+    SECTION("Smaller rectangles go to the tightest shelf")
+    {
+        REQUIRE(packer.insert(48, 32) == sf::Vector2u(0, 0));
+        REQUIRE(packer.insert(48, 8) == sf::Vector2u(0, 32));
+        REQUIRE(packer.insert(8, 8) == sf::Vector2u(48, 32));
+    }
+}
+
+TEST_CASE("ShelfPacker rejects rectangles that do not fit", "[obe.graphics.ShelfPacker]")
+{
+    ShelfPacker packer(32, 32);
+    CHECK_FALSE(packer.insert(33, 1));
+    CHECK_FALSE(packer.insert(1, 33));
+    CHECK_FALSE(packer.insert(0, 4));
+    REQUIRE(packer.insert(32, 32));
+    CHECK_FALSE(packer.insert(1, 1));
+    CHECK(packer.get_used_area() == 32 * 32);
+}
@@ -0,0 +1,287 @@
+#include <catch_amalgamated.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include <Tiles/Chunk.hpp>
+
+using obe::tiles::TileChunk;
+
+TEST_CASE("TileChunk only allocates the tilesets it uses", "[obe.tiles.TileChunk]")
+{
+    TileChunk chunk(0, 0);
+    REQUIRE(chunk.is_empty());
+    REQUIRE(chunk.get_vertex_count() == 0);
+
+    chunk.acquire_quad(1, 0, 0);
+    chunk.acquire_quad(1, 5, 7);
+    REQUIRE(chunk.get_quads().size() == 1);
+    REQUIRE(chunk.get_vertex_count() == TileChunk::Size * TileChunk::Size * 4);
+
+    chunk.acquire_quad(100, 3, 3);
+    REQUIRE(chunk.get_quads().size() == 2);
+    REQUIRE(chunk.get_quad(50, 3, 3) == nullptr);
+}
+
+TEST_CASE("TileChunk quads stay in place", "[obe.tiles.TileChunk]")
+{
+    TileChunk chunk(2, 1);
+    sf::Vertex* quad = chunk.acquire_quad(1, 4, 2);
+    quad[0].position = sf::Vector2f(10, 20);
+    for (uint32_t first_tile_id = 2; first_tile_id < 10; first_tile_id++)
+    {
+        chunk.acquire_quad(first_tile_id, 0, 0);
+    }
+    chunk.release_quad(2, 0, 0);
+    REQUIRE(chunk.get_quad(1, 4, 2) == quad);
+    REQUIRE(chunk.acquire_quad(1, 4, 2) == quad);
+    REQUIRE(quad[0].position == sf::Vector2f(10, 20));
+}
+
+TEST_CASE("TileChunk frees a tileset once all its quads are released", "[obe.tiles.TileChunk]")
+{
+    TileChunk chunk(0, 0);
+    chunk.acquire_quad(1, 0, 0);
+    chunk.acquire_quad(1, 1, 0);
+    chunk.release_quad(1, 0, 0);
+    REQUIRE(chunk.get_quads().size() == 1);
+    REQUIRE(chunk.get_quad(1, 0, 0)[0].position == sf::Vector2f(0, 0));
+    chunk.release_quad(1, 0, 0);
+    REQUIRE(chunk.get_quads().size() == 1);
+    chunk.release_quad(1, 1, 0);
+    REQUIRE(chunk.is_empty());
+}
+
+TEST_CASE("Cells overlapped by an area", "[obe.tiles.get_cells_in_area]")
+{
+    using obe::tiles::get_cells_in_area;
+    SECTION("Area inside the grid")
+    {
+        const auto cells = get_cells_in_area(sf::FloatRect(40, 70, 100, 50), 32, 16, 100, 100);
+        REQUIRE(cells);
+        CHECK(cells->left == 1);
+        CHECK(cells->top == 4);
+        CHECK(cells->right == 4);
+        CHECK(cells->bottom == 7);
+    }
+    SECTION("Area partially outside of the grid is clamped")
+    {
+        const auto cells = get_cells_in_area(sf::FloatRect(-100, -100, 5000, 200), 32, 32, 10, 10);
+        REQUIRE(cells);
+        CHECK(cells->left == 0);
+        CHECK(cells->top == 0);
+        CHECK(cells->right == 9);
+        CHECK(cells->bottom == 3);
+    }
+    SECTION("Area outside of the grid")
+    {
+        CHECK_FALSE(get_cells_in_area(sf::FloatRect(-100, 0, 50, 50), 32, 32, 10, 10));
+        CHECK_FALSE(get_cells_in_area(sf::FloatRect(0, 320, 50, 50), 32, 32, 10, 10));
+        CHECK_FALSE(get_cells_in_area(sf::FloatRect(0, 0, 50, 50), 0, 32, 10, 10));
+    }
+}
+
+TEST_CASE("Chunks overlapped by an area with mixed tile sizes",
+    "[obe.tiles.get_chunks_in_area]")
+{
+    using obe::tiles::get_chunks_in_area;
+    const sf::FloatRect view(1000, 1000, 200, 200);
+    SECTION("Chunks of larger tiles starting before the area are kept")
+    {
+        // 16px tiles put the view in chunks 1 to 2, 64px tiles of chunk 0 reach up to 2048px
+        const auto chunks = get_chunks_in_area(view, { { 16, 16 }, { 64, 64 } }, 10, 10);
+        REQUIRE(chunks);
+        CHECK(chunks->left == 0);
+        CHECK(chunks->top == 0);
+        CHECK(chunks->right == 2);
+        CHECK(chunks->bottom == 2);
+    }
+    SECTION("A single tile size gives the cells of its chunks")
+    {
+        const auto chunks = get_chunks_in_area(view, { { 16, 32 } }, 10, 10);
+        const auto cells = obe::tiles::get_cells_in_area(
+            view, 16 * TileChunk::Size, 32 * TileChunk::Size, 10, 10);
+        REQUIRE(chunks);
+        REQUIRE(cells);
+        CHECK(chunks->left == cells->left);
+        CHECK(chunks->top == cells->top);
+        CHECK(chunks->right == cells->right);
+        CHECK(chunks->bottom == cells->bottom);
+    }
+    SECTION("No tile size or an area outside of the layer")
+    {
+        CHECK_FALSE(get_chunks_in_area(view, {}, 10, 10));
+        CHECK_FALSE(get_chunks_in_area(
+            sf::FloatRect(-500, -500, 100, 100), { { 16, 16 }, { 64, 64 } }, 10, 10));
+    }
+}
+
+TEST_CASE("Cells are merged into rectangles", "[obe.tiles.merge_cells]")
+{
+    using obe::tiles::merge_cells;
+    SECTION("A solid block becomes a single rectangle")
+    {
+        const std::vector<uint32_t> groups(64 * 16, 1);
+        const auto rects = merge_cells(groups, 64, 16);
+        REQUIRE(rects.size() == 1);
+        CHECK(rects[0].left == 0);
+        CHECK(rects[0].top == 0);
+        CHECK(rects[0].right == 63);
+        CHECK(rects[0].bottom == 15);
+    }
+    SECTION("Different groups and empty cells are never merged")
+    {
+        // clang-format off
+        const std::vector<uint32_t> groups = {
+            1, 1, 2, 2,
+            1, 1, 0, 2,
+            0, 1, 1, 1,
+        };
+        // clang-format on
+        const auto rects = merge_cells(groups, 4, 3);
+        std::vector<uint32_t> coverage(groups.size(), 0);
+        for (const auto& rect : rects)
+        {
+            const uint32_t group = groups[rect.left + rect.top * 4];
+            for (uint32_t y = rect.top; y <= rect.bottom; y++)
+            {
+                for (uint32_t x = rect.left; x <= rect.right; x++)
+                {
+                    CHECK(groups[x + y * 4] == group);
+                    coverage[x + y * 4]++;
+                }
+            }
+        }
+        for (std::size_t i = 0; i < groups.size(); i++)
+        {
+            CHECK(coverage[i] == (groups[i] ? 1 : 0));
+        }
+        CHECK(rects.size() == 4);
+    }
+}
+
+TEST_CASE("Only colliders made of the tile corners cover the whole tile",
+    "[obe.tiles.is_whole_tile_collider]")
+{
+    using obe::tiles::is_whole_tile_collider;
+    using obe::transform::UnitVector;
+    using obe::transform::Units;
+    // Points are compared in ScenePixels, one pixel per SceneUnit keeps them as is
+    UnitVector::Screen.w = 1;
+    UnitVector::Screen.h = 1;
+    const auto make_collider = [](std::initializer_list<std::pair<double, double>> points) {
+        obe::collision::ComplexPolygonCollider collider;
+        for (const auto& [x, y] : points)
+        {
+            collider.add_point(UnitVector(x, y, Units::ScenePixels));
+        }
+        return collider;
+    };
+    SECTION("The tile rectangle in either winding")
+    {
+        CHECK(is_whole_tile_collider(make_collider({ { 0, 0 }, { 16, 0 }, { 16, 8 }, { 0, 8 } }),
+            16, 8));
+        CHECK(is_whole_tile_collider(make_collider({ { 16, 8 }, { 16, 0 }, { 0, 0 }, { 0, 8 } }),
+            16, 8));
+    }
+    SECTION("Quads touching every edge of the tile are not rectangles")
+    {
+        // Diamond and trapezoid share the bounding box of the tile
+        CHECK_FALSE(is_whole_tile_collider(
+            make_collider({ { 8, 0 }, { 16, 4 }, { 8, 8 }, { 0, 4 } }), 16, 8));
+        CHECK_FALSE(is_whole_tile_collider(
+            make_collider({ { 4, 0 }, { 12, 0 }, { 16, 8 }, { 0, 8 } }), 16, 8));
+        // Corners given in a self-intersecting order
+        CHECK_FALSE(is_whole_tile_collider(
+            make_collider({ { 0, 0 }, { 16, 8 }, { 16, 0 }, { 0, 8 } }), 16, 8));
+    }
+    SECTION("Rectangles of another size or position")
+    {
+        CHECK_FALSE(is_whole_tile_collider(
+            make_collider({ { 0, 0 }, { 16, 0 }, { 16, 4 }, { 0, 4 } }), 16, 8));
+        CHECK_FALSE(is_whole_tile_collider(
+            make_collider({ { 1, 0 }, { 17, 0 }, { 17, 8 }, { 1, 8 } }), 16, 8));
+        CHECK_FALSE(
+            is_whole_tile_collider(make_collider({ { 0, 0 }, { 16, 0 }, { 16, 8 } }), 16, 8));
+    }
+}
+
+TEST_CASE("Tile culling on a tall map", "[.][benchmark][obe.tiles.get_cells_in_area]")
+{
+    constexpr uint32_t tile_size = 16;
+    constexpr uint32_t width = 64;
+    constexpr uint32_t height = 8192;
+    constexpr uint32_t chunks_width = width / TileChunk::Size;
+    constexpr uint32_t chunks_height = height / TileChunk::Size;
+    std::vector<TileChunk> chunks;
+    chunks.reserve(chunks_width * chunks_height);
+    for (uint32_t chunk_y = 0; chunk_y < chunks_height; chunk_y++)
+    {
+        for (uint32_t chunk_x = 0; chunk_x < chunks_width; chunk_x++)
+        {
+            TileChunk& chunk = chunks.emplace_back(chunk_x, chunk_y);
+            for (uint32_t y = 0; y < TileChunk::Size; y++)
+            {
+                for (uint32_t x = 0; x < TileChunk::Size; x++)
+                {
+                    sf::Vertex* quad = chunk.acquire_quad(1, x, y);
+                    quad[0].position.x = static_cast<float>(chunk_x * TileChunk::Size + x);
+                }
+            }
+        }
+    }
+    // 1280x720 screen in the middle of the map
+    const sf::FloatRect view(0, height * tile_size / 2.f, 1280, 720);
+    const auto submit = [](const sf::Vertex* vertices, std::size_t count) {
+        float checksum = 0;
+        for (std::size_t i = 0; i < count; i += 4)
+        {
+            checksum += vertices[i].position.x;
+        }
+        return checksum;
+    };
+
+    BENCHMARK("Column culling (every row of the visible columns)")
+    {
+        const auto columns = obe::tiles::get_cells_in_area(view, tile_size * TileChunk::Size,
+            tile_size * TileChunk::Size, chunks_width, chunks_height);
+        float checksum = 0;
+        for (uint32_t chunk_y = 0; chunk_y < chunks_height; chunk_y++)
+        {
+            for (uint32_t chunk_x = columns->left; chunk_x <= columns->right; chunk_x++)
+            {
+                for (const auto& quads : chunks[chunk_x + chunk_y * chunks_width].get_quads())
+                {
+                    checksum += submit(quads.vertices.data(), quads.vertices.size());
+                }
+            }
+        }
+        return checksum;
+    };
+    BENCHMARK("Two-axis culling (visible chunks and rows only)")
+    {
+        const auto visible_chunks = obe::tiles::get_cells_in_area(view,
+            tile_size * TileChunk::Size, tile_size * TileChunk::Size, chunks_width, chunks_height);
+        const auto visible_tiles
+            = obe::tiles::get_cells_in_area(view, tile_size, tile_size, width, height);
+        float checksum = 0;
+        for (uint32_t chunk_y = visible_chunks->top; chunk_y <= visible_chunks->bottom; chunk_y++)
+        {
+            for (uint32_t chunk_x = visible_chunks->left; chunk_x <= visible_chunks->right;
+                 chunk_x++)
+            {
+                const uint32_t chunk_top = chunk_y * TileChunk::Size;
+                const uint32_t first_row = std::max(visible_tiles->top, chunk_top);
+                const uint32_t last_row
+                    = std::min(visible_tiles->bottom, chunk_top + TileChunk::Size - 1);
+                for (const auto& quads : chunks[chunk_x + chunk_y * chunks_width].get_quads())
+                {
+                    checksum += submit(quads.vertices.data()
+                            + (first_row - chunk_top) * TileChunk::Size * 4,
+                        (last_row - first_row + 1) * TileChunk::Size * 4);
+                }
+            }
+        }
+        return checksum;
+    };
+}
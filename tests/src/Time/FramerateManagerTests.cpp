@@ -0,0 +1,31 @@
+#include <catch_amalgamated.hpp>
+
+#include <spdlog/sinks/null_sink.h>
+
+#include <Debug/Logger.hpp>
+#include <Time/FramerateManager.hpp>
+
+using namespace obe::time;
+
+TEST_CASE("FramerateManager should start a frame on every update of a virtual clock",
+    "[obe.Time.FramerateManager]")
+{
+    // Virtual step shorter than the framerate target
+    set_virtual_clock(1.0 / 120);
+    FramerateManager framerate;
+    framerate.set_framerate_target(60);
+    framerate.start();
+    const std::uint64_t first_frame = get_frame_index();
+    const TimeUnit start = now();
+    for (int i = 1; i <= 10; i++)
+    {
+        framerate.update();
+        CHECK(framerate.should_update());
+        CHECK(framerate.should_render());
+        CHECK(framerate.get_raw_delta_time() == Catch::Approx(1.0 / 120));
+        framerate.reset();
+    }
+    CHECK(get_frame_index() == first_frame + 10);
+    CHECK(now() == Catch::Approx(start + 10.0 / 120));
+    set_virtual_clock(0);
+}
@@ -0,0 +1,41 @@
+#include <catch_amalgamated.hpp>
+
+#include <Time/TimeUtils.hpp>
+
+using namespace obe::time;
+
+TEST_CASE("The frame clock should only move when a frame starts", "[obe.Time.TimeUtils]")
+{
+    advance_frame();
+    const TimeUnit frame_time = now();
+    const std::uint64_t frame_index = get_frame_index();
+    const TimeUnit before = monotonic();
+    while (monotonic() == before)
+    {
+    }
+    CHECK(now() == frame_time);
+    CHECK(monotonic() >= before);
+
+    advance_frame();
+    CHECK(now() > frame_time);
+    CHECK(get_frame_index() == frame_index + 1);
+}
+
+TEST_CASE("The virtual frame clock should advance by a fixed step", "[obe.Time.TimeUtils]")
+{
+    advance_frame();
+    const TimeUnit start = now();
+    set_virtual_clock(0.25);
+    CHECK(is_clock_virtual());
+    CHECK(get_next_frame_time() == Catch::Approx(start + 0.25));
+    for (int i = 0; i < 8; i++)
+        advance_frame();
+    CHECK(now() == Catch::Approx(start + 2));
+
+    // Going back to the monotonic clock keeps the frame clock continuous
+    set_virtual_clock(0);
+    CHECK_FALSE(is_clock_virtual());
+    advance_frame();
+    CHECK(now() >= start + 2);
+    CHECK(now() < start + 3);
+}
@@ -0,0 +1,44 @@
+#include <catch_amalgamated.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <Utils/ThreadPool.hpp>
+
+using obe::utils::ThreadPool;
+
+TEST_CASE("ThreadPool runs every submitted job", "[obe.Utils.ThreadPool]")
+{
+    ThreadPool pool(3);
+    REQUIRE(pool.get_worker_count() == 3);
+    std::atomic<int> counter = 0;
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; i++)
+    {
+        results.push_back(pool.submit([&counter, i]() {
+            counter++;
+            return i * 2;
+        }));
+    }
+    for (int i = 0; i < 100; i++)
+    {
+        REQUIRE(results[i].get() == i * 2);
+    }
+    REQUIRE(counter == 100);
+}
+
+TEST_CASE("ThreadPool forwards exceptions through futures", "[obe.Utils.ThreadPool]")
+{
+    ThreadPool pool(1);
+    std::future<void> result = pool.submit([]() { throw std::runtime_error("failure"); });
+    REQUIRE_THROWS_AS(result.get(), std::runtime_error);
+    REQUIRE(pool.submit([]() { return 42; }).get() == 42);
+}
+
+TEST_CASE("ThreadPool always has at least one worker", "[obe.Utils.ThreadPool]")
+{
+    ThreadPool pool(0);
+    REQUIRE(pool.get_worker_count() == 1);
+    REQUIRE(ThreadPool::default_worker_count() >= 1);
+}